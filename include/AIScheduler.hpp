@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Boss.hpp"
+#include "Enemy.hpp"
+#include "IntentBuffer.hpp"
+#include "SlotMap.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief What the AI scheduler did in the last tick
+ */
+struct AIScheduleStats {
+    std::size_t full = 0;      // Enemies near the player, updated every tick
+    std::size_t reduced = 0;   // Distant enemies updated this tick
+    std::size_t deferred = 0;  // Distant enemies that were due but ran out of budget
+    std::size_t dormant = 0;   // Enemies far enough away to be frozen
+    float microseconds = 0.f;  // Time spent running AI this tick
+};
+
+/**
+ * @brief Decides which enemies run their AI each tick, and with how much time
+ *
+ * Enemies are sorted into level-of-detail tiers by distance to the player:
+ * - Full: on screen or within FULL_RADIUS, AI runs every tick
+ * - Reduced: within DORMANT_RADIUS, AI runs every REDUCED_INTERVAL ticks
+ *   with the time accumulated since its last run (staggered by slot so the
+ *   distant enemies don't all think on the same tick)
+ * - Dormant: further away, AI is frozen and time doesn't pass for it; the
+ *   body stops moving on its own too (grounded enemies still fall)
+ *
+ * Reduced-tier updates also share a per-tick budget in microseconds; once it
+ * is spent, the remaining due enemies wait for the next tick, where the most
+ * overdue go first. Full-tier enemies are never deferred, and their time
+ * doesn't count against the budget, so a busy screen can't starve the
+ * distant enemies. Bodies keep being stepped and collided every tick
+ * regardless of tier; only the AI is scheduled.
+ *
+ * The AI runs in two phases. The scheduled updates run in parallel on the
+ * ThreadPool, each recording its particles and shots into its own
+ * IntentBuffer; the buffers are then committed on the calling thread in
+ * schedule order (full tier in slot order, boss, reduced tier), so the result
+ * doesn't depend on how many threads there are or which one ran what.
+ *
+ * Usage: scheduler.update(enemies, boss, player.getPosition(), camera.getVisibleRect(), dt);
+ */
+class AIScheduler {
+public:
+    enum class Tier : std::uint8_t {
+        Full,
+        Reduced,
+        Dormant
+    };
+
+    AIScheduler();
+
+    /**
+     * @brief Run this tick's enemy AI
+     * @param boss Level boss (may be null), updated every tick alongside the full tier
+     * @param targetPosition Player position, handed to every enemy that runs
+     * @param viewRect World-space rectangle on screen (enemies in it always run fully)
+     */
+    void update(SlotMap<std::unique_ptr<Enemy>>& enemies, Boss* boss, const sf::Vector2f& targetPosition,
+                const sf::FloatRect& viewRect, float deltaTime);
+
+    /**
+     * @brief Tier an enemy at a given position falls into
+     */
+    static Tier classify(const sf::FloatRect& enemyBounds, const sf::Vector2f& targetPosition,
+                         const sf::FloatRect& viewRect);
+
+    /**
+     * @brief Per-tick time for reduced-tier AI (0 = unlimited)
+     */
+    void setBudgetMicroseconds(float microseconds) { m_budgetMicroseconds = microseconds; }
+    float getBudgetMicroseconds() const { return m_budgetMicroseconds; }
+
+    const AIScheduleStats& getStats() const { return m_stats; }
+
+    static constexpr float FULL_RADIUS = 800.f;
+    static constexpr float DORMANT_RADIUS = 1600.f;
+    static constexpr unsigned int REDUCED_INTERVAL = 4;
+    static constexpr float MAX_ACCUMULATED_TIME = 0.25f;  // Longest step handed to a reduced-tier AI
+    static constexpr float DEFAULT_BUDGET_MICROSECONDS = 1000.f;
+    static constexpr std::size_t PARALLEL_GRAIN = 16;  // Updates per pool chunk
+    static constexpr std::size_t REDUCED_BATCH = 64;   // Reduced-tier updates between budget checks
+
+private:
+    // Scheduling state of the enemy in one slot of the slot map
+    struct Entry {
+        std::uint32_t generation = 0;
+        bool tracked = false;
+        unsigned int ticksWaited = 0;  // Ticks since the AI last ran
+        float pendingTime = 0.f;       // Simulation time since the AI last ran
+    };
+
+    // One update to run this tick
+    struct Job {
+        Entity* entity;
+        float step;
+    };
+
+    Entry& entryFor(SlotHandle handle);
+    void scheduleEnemy(Enemy& enemy, Entry& entry, const sf::Vector2f& targetPosition);
+    void runJobs(std::size_t begin, std::size_t end);
+
+    std::vector<Entry> m_entries;  // Indexed by slot
+    std::vector<std::size_t> m_due;  // Reused list of reduced-tier enemies due this tick
+    std::vector<Job> m_jobs;  // This tick's updates, in commit order
+    std::vector<IntentBuffer> m_intents;  // One per job, reused across ticks
+    float m_budgetMicroseconds;
+    AIScheduleStats m_stats;
+};
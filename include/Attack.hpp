@@ -1,6 +1,14 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 
+class SpriteBatch;
+
+/**
+ * @brief One player swing: hitbox, damage and lifetime
+ *
+ * Plain value type so AttackPool can keep a fixed array of them; the
+ * hitbox visual is built from the hitbox when drawn instead of stored.
+ */
 class Attack {
 public:
     enum class Type {
@@ -10,10 +18,15 @@ public:
         Down
     };
 
+    Attack();
     Attack(Type type, const sf::Vector2f& position, bool facingRight, float damageMultiplier = 1.0f);
     
     void update(float deltaTime);
-    void render(sf::RenderWindow& window);
+    
+    /**
+     * @brief Queue the fading hitbox visual (debug feedback)
+     */
+    void render(SpriteBatch& batch) const;
     
     bool isActive() const { return m_isActive; }
     sf::FloatRect getHitbox() const { return m_hitbox; }
@@ -27,5 +40,4 @@ private:
     float m_lifetime;
     float m_duration;
     bool m_isActive;
-    sf::RectangleShape m_visualHitbox; // For debugging/visual feedback
 };
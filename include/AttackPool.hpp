@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Attack.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+class SpriteBatch;
+
+/**
+ * @brief Reference to a pooled attack that goes stale when the attack ends
+ *
+ * The generation changes every time a slot is reused, so an old handle can
+ * never reach a newer attack that happens to sit in the same slot.
+ */
+struct AttackHandle {
+    std::uint16_t index = INVALID_INDEX;
+    std::uint16_t generation = 0;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+
+    static constexpr std::uint16_t INVALID_INDEX = 0xFFFF;
+};
+
+/**
+ * @brief Fixed-capacity storage for the player's live attacks
+ *
+ * Attacks are plain values in a fixed array, so swinging never touches the
+ * heap. Live slots are kept in a dense list for iteration; expired attacks
+ * go back on a free list and their slot's generation is bumped.
+ *
+ * Usage: AttackHandle swing = pool.spawn(Attack::Type::Light, position, facingRight);
+ *        for (std::size_t i = 0; i < pool.getActiveCount(); ++i) hit(pool.getActive(i));
+ */
+class AttackPool {
+public:
+    AttackPool();
+
+    /**
+     * @brief Start an attack
+     * @return Handle to it, or an invalid handle if the pool is full (the swing is dropped)
+     */
+    AttackHandle spawn(Attack::Type type, const sf::Vector2f& position, bool facingRight, float damageMultiplier = 1.0f);
+
+    /**
+     * @brief Attack a handle refers to, or null if it has ended
+     */
+    Attack* get(AttackHandle handle);
+    const Attack* get(AttackHandle handle) const;
+
+    /**
+     * @brief End an attack early (no-op for stale handles)
+     */
+    void release(AttackHandle handle);
+
+    /**
+     * @brief Age every attack and free the ones that expired
+     */
+    void update(float deltaTime);
+
+    /**
+     * @brief Queue hitbox visuals for every live attack, if enabled
+     */
+    void render(SpriteBatch& batch) const;
+
+    void clear();
+
+    // Dense iteration over live attacks (order changes as attacks end)
+    std::size_t getActiveCount() const { return m_activeCount; }
+    const Attack& getActive(std::size_t i) const { return m_attacks[m_active[i]]; }
+    bool isEmpty() const { return m_activeCount == 0; }
+
+    // Hitbox visuals are debug feedback and can be switched off
+    void setShowHitboxes(bool show) { m_showHitboxes = show; }
+    bool isShowingHitboxes() const { return m_showHitboxes; }
+
+    // Swings overlap by at most a couple of attacks, this leaves headroom for rapid combos
+    static constexpr std::size_t CAPACITY = 16;
+
+private:
+    void releaseSlot(std::size_t slot);
+
+    std::array<Attack, CAPACITY> m_attacks;
+    std::array<std::uint16_t, CAPACITY> m_generations;
+    std::array<std::uint16_t, CAPACITY> m_denseIndex;  // Slot -> position in m_active
+    std::array<std::uint16_t, CAPACITY> m_active;  // Live slots, packed
+    std::array<std::uint16_t, CAPACITY> m_free;  // Free slots, used as a stack
+    std::size_t m_activeCount;
+    std::size_t m_freeCount;
+    bool m_showHitboxes;
+};
@@ -2,8 +2,10 @@
 
 #include "Entity.hpp"
 #include "Animation.hpp"
-#include "ParticleSystem.hpp"
+#include "ParticleEmitter.hpp"
+#include "TextureAtlas.hpp"
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 /**
  * @brief Boss enemy class with enhanced AI and multiple attack patterns
@@ -19,10 +21,11 @@ public:
         Phase2   // Enraged, faster attacks
     };
     
-    Boss(BossType type, const sf::Vector2f& startPosition);
+    Boss(EntityStore& store, BossType type, const sf::Vector2f& startPosition);
     
     void update(float deltaTime) override;
-    void render(sf::RenderWindow& window) const override;
+    void render(SpriteBatch& batch) const override;
+    void setIntentBuffer(IntentBuffer* intents) override;
     
     void setTarget(const sf::Vector2f& targetPos);
     bool isAttacking() const { return m_isAttacking; }
@@ -56,8 +59,8 @@ private:
     mutable sf::RectangleShape m_healthBarBackground;
     mutable sf::RectangleShape m_healthBar;
     mutable AnimationController m_animController;
-    mutable ParticleSystem m_particles;
-    sf::Texture m_texture;
+    ParticleEmitter m_particles{ParticleLayer::BehindEntities};
+    AtlasRegion m_sheet;  // Sprite sheet in the shared atlas (no texture when headless)
     mutable std::optional<sf::Sprite> m_sprite;
     bool m_facingRight;
     
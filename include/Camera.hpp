@@ -24,6 +24,23 @@ public:
      */
     sf::View getView() const;
     
+    /**
+     * @brief Get the camera view blended between the previous and current tick
+     * @param alpha 0 = previous tick, 1 = current tick
+     */
+    sf::View getView(float alpha) const;
+    
+    /**
+     * @brief World-space rectangle the view covers (shake included)
+     * @param alpha 0 = previous tick, 1 = current tick
+     */
+    sf::FloatRect getVisibleRect(float alpha = 1.f) const;
+    
+    /**
+     * @brief Remember the current view centre as the start of the next tick
+     */
+    void savePreviousState() { m_previousCenter = m_view.getCenter(); }
+    
     /**
      * @brief Shake the camera for impact feedback
      */
@@ -42,6 +59,7 @@ public:
 private:
     sf::View m_view;
     sf::Vector2f m_position;
+    sf::Vector2f m_previousCenter;  // View centre at the start of the current tick
     sf::Vector2f m_size;
     
     // Camera bounds
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "Platform.hpp"
+#include "PlatformGrid.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief What a body touched during the last collision pass
+ */
+struct PlatformContacts {
+    bool onGround = false;
+    bool wallOnLeft = false;
+    bool wallOnRight = false;
+};
+
+/**
+ * @brief Body submitted to a collision pass
+ */
+struct CollisionBody {
+    explicit CollisionBody(Entity* body) : entity(body) {}
+    
+    Entity* entity;
+    PlatformContacts contacts;  // Filled in by resolve()
+    std::uint64_t cellKey = 0;  // Broadphase cell range, used to sort the batch
+};
+
+/**
+ * @brief Resolves entity bodies against level platforms in one batched pass
+ * 
+ * Bodies are sorted by the grid cells they cover so neighbours are resolved
+ * back to back and share one broadphase query. Solid and moving platforms
+ * block from every side; one-way platforms only catch bodies falling onto
+ * them from above. Moving platforms carry bodies standing on them.
+ * 
+ * Each body is first swept from its previous tick position to its current
+ * one, so a long move (fast fall, dash, large tick) stops at the first
+ * platform in its path instead of passing through it.
+ */
+class CollisionSystem {
+public:
+    CollisionSystem() = default;
+    
+    /**
+     * @brief Push every body out of the platforms it overlaps
+     * @param bodies Bodies to resolve (reordered by cell)
+     * @param deltaTime Tick length, used for moving platform carry
+     */
+    void resolve(std::vector<CollisionBody>& bodies, const std::vector<Platform>& platforms,
+                 const PlatformGrid& grid, float deltaTime);
+    
+    /**
+     * @brief Area covered by an entity's move this tick (previous and current bounds)
+     */
+    static sf::FloatRect getSweptBounds(const Entity& entity);
+    
+    /**
+     * @brief Stop an entity's move at the first platform it would pass through
+     * 
+     * Sweeps the entity's bounds from its previous position to its current one.
+     * On a hit the move along the hit axis ends just inside the platform, and
+     * the rest of the other axis's move is swept again from the contact point,
+     * so a body sliding along a floor still stops at a wall. The regular
+     * overlap resolution then lands it or stops it at the wall. Platforms it
+     * started more than SWEEP_INSET inside are left to that resolution, and
+     * one-way platforms only stop bodies coming down onto them.
+     * @param candidates Platform indices from a broadphase query over getSweptBounds()
+     * @return True if the move was shortened
+     */
+    static bool sweepMove(Entity& entity, const std::vector<Platform>& platforms,
+                          const std::vector<std::size_t>& candidates);
+    
+private:
+    void resolveBody(CollisionBody& body, const std::vector<Platform>& platforms, float deltaTime) const;
+    
+    std::vector<std::size_t> m_candidates;  // Reused broadphase results
+    
+    static constexpr float ONE_WAY_TOLERANCE = 1.f;  // Pixels a body may already be below the top edge
+    static constexpr float CONTACT_SKIN = 0.05f;  // How far sweepMove leaves a body inside the platform it hit
+    static constexpr float SWEEP_INSET = 2.f * CONTACT_SKIN;  // Swept box shrink per side, so skin-deep bodies still hit
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+
+/**
+ * @brief Plain data components stored in EntityStore chunks
+ *
+ * Components hold only the hot simulation state that systems sweep every
+ * tick. Render state (shapes, sprites, animation, particle emitters) stays in
+ * the entity objects, so a sweep never pulls it into cache.
+ */
+
+using ComponentMask = std::uint8_t;
+
+/**
+ * @brief Where an entity is, where it was at the start of the tick, and how big it is
+ */
+struct TransformComponent {
+    sf::Vector2f position;
+    sf::Vector2f previousPosition;  // Position at the start of the current tick (interpolation, swept collision)
+    sf::Vector2f size{32.f, 32.f};
+};
+
+/**
+ * @brief Velocity and the per-tick forces the batched body step applies
+ */
+struct PhysicsBodyComponent {
+    sf::Vector2f velocity;
+    float friction = 1.f;  // Horizontal velocity kept per tick
+    bool usesGravity = false;
+};
+
+/**
+ * @brief Hit points and the invulnerability window after taking damage
+ */
+struct HealthComponent {
+    int health = 100;
+    int maxHealth = 100;
+    bool invulnerable = false;  // Temporary invulnerability after taking damage
+    float invulnerabilityTimer = 0.f;
+};
+
+/**
+ * @brief Per-tick combat AI state of a regular enemy
+ */
+struct AIComponent {
+    sf::Vector2f targetPosition;
+    float attackTimer = 0.f;  // Cooldown until the next attack
+    bool attacking = false;
+    bool hovers = false;       // Body steers toward hoverTargetY every tick instead of falling
+    float hoverTargetY = 0.f;  // Height the AI last chose to hover at
+    bool dormant = false;      // AI frozen by the scheduler; the body holds still too
+};
+
+/**
+ * @brief Maps a component type to its bit in an archetype mask
+ */
+template <typename Component>
+struct ComponentTraits;
+
+template <>
+struct ComponentTraits<TransformComponent> {
+    static constexpr ComponentMask BIT = 1 << 0;
+};
+
+template <>
+struct ComponentTraits<PhysicsBodyComponent> {
+    static constexpr ComponentMask BIT = 1 << 1;
+};
+
+template <>
+struct ComponentTraits<HealthComponent> {
+    static constexpr ComponentMask BIT = 1 << 2;
+};
+
+template <>
+struct ComponentTraits<AIComponent> {
+    static constexpr ComponentMask BIT = 1 << 3;
+};
+
+/**
+ * @brief Archetype mask of a set of component types
+ */
+template <typename... Components>
+constexpr ComponentMask componentMask() {
+    return static_cast<ComponentMask>((ComponentTraits<Components>::BIT | ...));
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include "ViewCuller.hpp"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
@@ -48,6 +49,7 @@ public:
     }
     
     bool isAlive() const { return m_lifetime > 0.f; }
+    sf::FloatRect getBounds() const { return m_shape.getGlobalBounds(); }
     
     void render(sf::RenderWindow& window) const {
         window.draw(m_shape);
@@ -89,6 +91,7 @@ public:
     }
     
     bool isAlive() const { return m_lifetime > 0.f; }
+    sf::FloatRect getBounds() const { return m_text.getGlobalBounds(); }
     
     void render(sf::RenderWindow& window) const {
         window.draw(m_text);
@@ -128,8 +131,10 @@ public:
         );
     }
     
-    void render(sf::RenderWindow& window) const {
+    void render(sf::RenderWindow& window, ViewCuller& culler) const {
         for (const auto& seg : m_segments) {
+            if (!culler.isVisible(sf::FloatRect(seg.position, seg.size))) continue;
+            
             sf::RectangleShape rect(seg.size);
             rect.setPosition(seg.position);
             sf::Color col = seg.color;
@@ -153,7 +158,11 @@ public:
     EffectsManager();
     
     void update(float deltaTime);
-    void render(sf::RenderWindow& window) const;
+    
+    /**
+     * @brief Draw every effect inside the culler's view
+     */
+    void render(sf::RenderWindow& window, ViewCuller& culler) const;
     
     void addFlash(const sf::Vector2f& position, const sf::Color& color, 
                   float radius, float duration = 0.1f);
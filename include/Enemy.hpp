@@ -2,35 +2,12 @@
 
 #include "Entity.hpp"
 #include "Animation.hpp"
-#include "ParticleSystem.hpp"
+#include "ParticleEmitter.hpp"
+#include "TextureAtlas.hpp"
+#include "CollisionSystem.hpp"
 #include <SFML/Graphics.hpp>
-#include <vector>
-#include <memory>
 
-/**
- * @brief Projectile class for ranged enemy attacks
- */
-class Projectile {
-public:
-    Projectile(const sf::Vector2f& position, const sf::Vector2f& direction, float speed, int damage, const sf::Color& color);
-    
-    void update(float deltaTime);
-    void render(sf::RenderWindow& window) const;
-    
-    sf::FloatRect getBounds() const;
-    bool isActive() const { return m_active; }
-    void deactivate() { m_active = false; }
-    int getDamage() const { return m_damage; }
-    
-private:
-    sf::Vector2f m_position;
-    sf::Vector2f m_velocity;
-    int m_damage;
-    bool m_active;
-    float m_lifetime;
-    mutable sf::CircleShape m_shape;
-    mutable ParticleSystem m_trail;
-};
+class ProjectileSystem;
 
 /**
  * @brief Basic enemy class with AI
@@ -51,22 +28,40 @@ public:
         Retreat   // For ranged enemies
     };
     
-    Enemy(const sf::Vector2f& startPosition, float patrolRange = 200.f, EnemyType type = EnemyType::Melee);
+    Enemy(EntityStore& store, const sf::Vector2f& startPosition, float patrolRange = 200.f, EnemyType type = EnemyType::Melee);
     ~Enemy() override = default;
     
+    /**
+     * @brief Run the enemy's AI for one tick
+     *
+     * The body step, attack cooldown, friction and gravity are applied to all
+     * enemies beforehand by EntitySystems::updateEnemyBodies().
+     */
     void update(float deltaTime) override;
-    void render(sf::RenderWindow& window) const override;
+    void render(SpriteBatch& batch) const override;
+    void onPlatformContact(const PlatformContacts& contacts) override;
+    void setIntentBuffer(IntentBuffer* intents) override;
     
     // AI methods
     void setTarget(const sf::Vector2f& targetPos);
     AIState getAIState() const { return m_aiState; }
+    
+    /**
+     * @brief Freeze the enemy's body while its AI is frozen (set by the AI scheduler)
+     */
+    void setDormant(bool dormant) { m_ai->dormant = dormant; }
+    bool isDormant() const { return m_ai->dormant; }
     EnemyType getType() const { return m_type; }
     
     // Combat
     sf::FloatRect getAttackHitbox() const;
-    bool isAttacking() const { return m_isAttacking; }
+    bool isAttacking() const { return m_ai->attacking; }
     int getAttackDamage() const { return m_attackDamage; }
-    const std::vector<std::unique_ptr<Projectile>>& getProjectiles() const { return m_projectiles; }
+    
+    /**
+     * @brief Level-wide shot storage ranged enemies fire into (null: can't shoot)
+     */
+    void setProjectileSystem(ProjectileSystem* projectiles) { m_projectiles = projectiles; }
     
     // Override takeDamage to add knockback
     void takeDamage(int damage) override;
@@ -88,7 +83,7 @@ private:
     sf::Vector2f m_patrolOrigin;
     float m_patrolRange;
     float m_patrolDirection;  // -1 (left) or 1 (right)
-    sf::Vector2f m_targetPosition;
+    AIComponent* m_ai;  // Target and attack cooldown, swept with the body each tick
     
     // Flying enemy specific
     float m_hoverHeight;  // Target height above ground
@@ -96,20 +91,19 @@ private:
     bool m_isSwooping;
     
     // Combat
-    bool m_isAttacking;
-    float m_attackTimer;
     int m_attackDamage;
-    std::vector<std::unique_ptr<Projectile>> m_projectiles;
+    ProjectileSystem* m_projectiles;  // Owned by the world
+    IntentBuffer* m_intents;  // Set while the AI runs off the main thread
     bool m_canBeKnockedBack;  // Tank enemies resist knockback
     
     // Rendering
     mutable sf::RectangleShape m_shape;
     mutable sf::RectangleShape m_healthBar;
     mutable sf::RectangleShape m_healthBarBackground;
-    sf::Texture m_texture;
+    AtlasRegion m_sheet;  // Sprite sheet in the shared atlas (no texture when headless)
     mutable std::optional<sf::Sprite> m_sprite;
     AnimationController m_animController;
-    mutable ParticleSystem m_particles;
+    ParticleEmitter m_particles{ParticleLayer::BehindEntities};
     bool m_facingRight;
     
     // Helper methods
@@ -1,17 +1,33 @@
 #pragma once
 
+#include "EntityStore.hpp"
 #include <SFML/Graphics.hpp>
 
+class IntentBuffer;
+struct PlatformContacts;
+class SpriteBatch;
+
 /**
  * @brief Base class for all game entities (player, enemies, objects)
  * 
  * Provides common functionality: position, velocity, rendering, updating
  * Uses composition over inheritance where possible
+ *
+ * The simulation state (transform, physics body, health) lives in the
+ * world's EntityStore so systems can sweep it for every entity at once; the
+ * entity object keeps pointers to its own rows plus its render state.
  */
 class Entity {
 public:
-    Entity();
-    virtual ~Entity() = default;
+    /**
+     * @param store Component storage the entity's simulation state lives in
+     * @param components Archetype; always includes transform, physics body and health
+     */
+    explicit Entity(EntityStore& store, ComponentMask components = BASE_COMPONENTS);
+    virtual ~Entity();
+    
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete;
     
     /**
      * @brief Update entity logic
@@ -20,10 +36,43 @@ public:
     virtual void update(float deltaTime);
     
     /**
-     * @brief Render entity to window
-     * @param window Target render window
+     * @brief Queue the entity's sprites and shapes for drawing
+     * @param batch Render queue flushed by the game once per frame
+     */
+    virtual void render(SpriteBatch& batch) const;
+    
+    /**
+     * @brief Render at a blend between the previous and current tick positions
+     * @param batch Render queue flushed by the game once per frame
+     * @param alpha 0 = previous tick, 1 = current tick
+     */
+    void renderInterpolated(SpriteBatch& batch, float alpha);
+    
+    /**
+     * @brief Remember the current position as the start of the next tick
+     *
+     * Also call after teleporting so the renderer doesn't blend across the jump.
+     */
+    void savePreviousState() { m_transform->previousPosition = m_transform->position; }
+    
+    /**
+     * @brief Position at the start of the current tick (where this tick's move began)
+     */
+    sf::Vector2f getPreviousPosition() const { return m_transform->previousPosition; }
+    
+    /**
+     * @brief Called after the world resolves this entity against platforms
+     * @param contacts Ground and wall contacts from this tick's collision pass
      */
-    virtual void render(sf::RenderWindow& window) const;
+    virtual void onPlatformContact(const PlatformContacts& contacts);
+    
+    /**
+     * @brief Record particles and shots spawned during update() instead of spawning them
+     * @param intents Buffer the caller commits afterwards, or null to spawn directly
+     *
+     * Lets update() run on a worker thread; the base entity spawns nothing.
+     */
+    virtual void setIntentBuffer(IntentBuffer* intents);
     
     // Position and movement
     void setPosition(const sf::Vector2f& pos);
@@ -50,21 +99,22 @@ public:
     virtual void takeDamage(int damage);
     void heal(int amount);
     void setMaxHealth(int maxHealth);
-    int getHealth() const { return m_health; }
-    int getMaxHealth() const { return m_maxHealth; }
-    bool isDead() const { return m_health <= 0; }
-    float getHealthPercentage() const { return static_cast<float>(m_health) / m_maxHealth; }
+    int getHealth() const { return m_vitals->health; }
+    int getMaxHealth() const { return m_vitals->maxHealth; }
+    bool isDead() const { return m_vitals->health <= 0; }
+    float getHealthPercentage() const { return static_cast<float>(m_vitals->health) / m_vitals->maxHealth; }
+    
+    static constexpr ComponentMask BASE_COMPONENTS =
+        componentMask<TransformComponent, PhysicsBodyComponent, HealthComponent>();
     
 protected:
-    sf::Vector2f m_position;
-    sf::Vector2f m_velocity;
-    sf::Vector2f m_size;
-    bool m_active;
+    EntityStore& m_store;
+    EntityId m_id;
+    
+    // This entity's rows in m_store (rows never move while the entity lives)
+    TransformComponent* m_transform;
+    PhysicsBodyComponent* m_body;
+    HealthComponent* m_vitals;
     
-    // Health system
-    int m_health;
-    int m_maxHealth;
-    bool m_invulnerable;  // Temporary invulnerability after taking damage
-    float m_invulnerabilityTimer;
     static constexpr float INVULNERABILITY_DURATION = 0.5f;  // Half second of invulnerability
 };
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Components.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Location of an entity's components in an EntityStore
+ */
+struct EntityId {
+    std::uint16_t archetype = INVALID_INDEX;
+    std::uint16_t chunk = 0;
+    std::uint16_t row = 0;
+
+    bool isValid() const { return archetype != INVALID_INDEX; }
+
+    static constexpr std::uint16_t INVALID_INDEX = 0xFFFF;
+};
+
+/**
+ * @brief Archetype-chunked component storage for the world's entities
+ *
+ * Entities with the same set of components (an archetype) share fixed-size
+ * chunks, and each chunk keeps one contiguous array per component. A system
+ * asks for the components it needs and sweeps every matching chunk row by
+ * row, instead of calling into each entity object in turn.
+ *
+ * Rows never move: a destroyed entity's row goes on its archetype's free
+ * list and is reused by the next entity of that archetype. Entity objects can
+ * therefore keep plain pointers to their components for their whole life.
+ * Disabled rows (inactive entities) are skipped by forEach().
+ *
+ * Usage: EntityId id = store.create(componentMask<TransformComponent, HealthComponent>());
+ *        store.forEach<TransformComponent>([](TransformComponent& t) { t.previousPosition = t.position; });
+ */
+class EntityStore {
+public:
+    EntityStore() = default;
+
+    EntityStore(const EntityStore&) = delete;
+    EntityStore& operator=(const EntityStore&) = delete;
+
+    /**
+     * @brief Add an entity with default-initialised components (starts enabled)
+     */
+    EntityId create(ComponentMask components);
+
+    /**
+     * @brief Free an entity's row for reuse (no-op for invalid ids)
+     */
+    void destroy(EntityId id);
+
+    /**
+     * @brief An entity's component, or null if its archetype doesn't have one
+     */
+    template <typename Component>
+    Component* get(EntityId id);
+
+    bool isEnabled(EntityId id) const;
+    void setEnabled(EntityId id, bool enabled);
+
+    /**
+     * @brief Call function(components&...) for every enabled entity that has all of them
+     *
+     * Archetypes and rows are visited in creation order.
+     */
+    template <typename... Components, typename Function>
+    void forEach(Function&& function);
+
+    std::size_t getEntityCount() const { return m_entityCount; }
+
+    static constexpr std::size_t CHUNK_CAPACITY = 64;
+
+private:
+    template <typename Component>
+    using Column = std::unique_ptr<Component[]>;
+
+    struct Chunk {
+        explicit Chunk(ComponentMask components);
+
+        template <typename Component>
+        Component* column() { return std::get<Column<Component>>(columns).get(); }
+
+        template <typename Component>
+        void allocate(ComponentMask components);
+
+        // Only the archetype's own columns are allocated
+        std::tuple<Column<TransformComponent>, Column<PhysicsBodyComponent>,
+                   Column<HealthComponent>, Column<AIComponent>> columns;
+        std::array<std::uint8_t, CHUNK_CAPACITY> alive{};
+        std::array<std::uint8_t, CHUNK_CAPACITY> enabled{};
+        std::size_t used = 0;  // Rows handed out so far (live or freed)
+    };
+
+    struct Archetype {
+        ComponentMask components = 0;
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        std::vector<std::pair<std::uint16_t, std::uint16_t>> freeRows;  // (chunk, row)
+    };
+
+    Chunk* findChunk(EntityId id);
+    const Chunk* findChunk(EntityId id) const;
+
+    template <typename Component>
+    static void resetComponent(Chunk& chunk, std::size_t row);
+
+    std::vector<Archetype> m_archetypes;
+    std::size_t m_entityCount = 0;
+};
+
+template <typename Component>
+void EntityStore::Chunk::allocate(ComponentMask components) {
+    if (components & ComponentTraits<Component>::BIT) {
+        std::get<Column<Component>>(columns) = std::make_unique<Component[]>(CHUNK_CAPACITY);
+    }
+}
+
+template <typename Component>
+void EntityStore::resetComponent(Chunk& chunk, std::size_t row) {
+    if (Component* column = chunk.column<Component>()) {
+        column[row] = Component{};
+    }
+}
+
+template <typename Component>
+Component* EntityStore::get(EntityId id) {
+    Chunk* chunk = findChunk(id);
+    if (!chunk) return nullptr;
+
+    Component* column = chunk->column<Component>();
+    return column ? &column[id.row] : nullptr;
+}
+
+template <typename... Components, typename Function>
+void EntityStore::forEach(Function&& function) {
+    constexpr ComponentMask required = componentMask<Components...>();
+    for (auto& archetype : m_archetypes) {
+        if ((archetype.components & required) != required) continue;
+
+        for (auto& chunk : archetype.chunks) {
+            const auto columns = std::make_tuple(chunk->template column<Components>()...);
+            for (std::size_t row = 0; row < chunk->used; ++row) {
+                if (!chunk->enabled[row]) continue;
+                function(std::get<Components*>(columns)[row]...);
+            }
+        }
+    }
+}
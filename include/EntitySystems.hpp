@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Components.hpp"
+#include "EntityStore.hpp"
+
+/**
+ * @brief Systems that sweep entity components stored in an EntityStore
+ *
+ * Each system visits every enabled entity with the components it needs,
+ * chunk by chunk, so per-tick work that is the same for every entity costs
+ * one linear pass instead of a virtual call per entity.
+ */
+namespace EntitySystems {
+    /**
+     * @brief Base per-tick body step: run down invulnerability, then move by velocity
+     */
+    void stepBody(TransformComponent& transform, const PhysicsBodyComponent& body,
+                  HealthComponent& health, float deltaTime);
+
+    /**
+     * @brief Record every entity's position as the start of the next tick
+     */
+    void savePreviousState(EntityStore& store);
+
+    /**
+     * @brief Set a hovering body's vertical speed toward its hover height
+     */
+    void steerHover(const TransformComponent& transform, PhysicsBodyComponent& body, const AIComponent& ai);
+
+    /**
+     * @brief Pre-AI tick for every enemy: base body step, attack cooldown, friction, gravity and hover
+     *
+     * Dead enemies only get the body step; Enemy::update() deactivates them.
+     * Dormant enemies stop moving on their own, only gravity still acts.
+     * Hovering is steered here every tick, so enemies whose AI is skipped
+     * this tick don't coast on a stale vertical speed.
+     */
+    void updateEnemyBodies(EntityStore& store, float deltaTime);
+}
@@ -3,19 +3,17 @@
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <vector>
-#include "Player.hpp"
-#include "Platform.hpp"
-#include "Camera.hpp"
-#include "Enemy.hpp"
-#include "Boss.hpp"
-#include "EffectsManager.hpp"
+#include "GameWorld.hpp"
 #include "HUD.hpp"
+#include "LevelGeometry.hpp"
+#include "SpriteBatch.hpp"
+#include "ViewCuller.hpp"
 
 /**
  * @brief Main game class following the Game Loop pattern
  * 
- * This class manages the game window, handles events, updates game state,
- * and renders everything. Follows the standard game loop architecture.
+ * This class manages the game window, handles events, feeds input into the
+ * GameWorld simulation, and renders it. Follows the standard game loop architecture.
  */
 class Game {
 public:
@@ -31,51 +29,90 @@ public:
      */
     void run();
     
-private:
     /**
-     * @brief Process all input events (keyboard, mouse, window events)
+     * @brief Toggle fixed-timestep simulation (on by default)
+     *
+     * When enabled, update() always receives the same delta and rendering
+     * interpolates between the last two ticks. When disabled, update() gets
+     * the raw frame time as before.
      */
-    void processEvents();
+    void setFixedTimestep(bool enabled) { m_fixedTimestep = enabled; }
+    bool isFixedTimestep() const { return m_fixedTimestep; }
     
     /**
-     * @brief Update game logic
-     * @param deltaTime Time elapsed since last frame in seconds
+     * @brief Set the simulation rate in ticks per second
      */
-    void update(float deltaTime);
+    void setTickRate(unsigned int ticksPerSecond);
     
     /**
-     * @brief Render all game objects
+     * @brief Limit ticks run in one frame after a stall (excess time is dropped)
+     */
+    void setMaxCatchUpSteps(int steps);
+    
+    /**
+     * @brief Cap the render rate in frames per second (0 = uncapped)
+     *
+     * Rendering is independent of the tick rate. A non-zero cap turns vertical
+     * sync off, since SFML doesn't support using both at once.
+     */
+    void setFrameRateLimit(unsigned int framesPerSecond);
+    
+    /**
+     * @brief Render at the display's refresh rate (on by default)
+     *
+     * Enabling it removes any frame rate cap.
+     */
+    void setVerticalSyncEnabled(bool enabled);
+    
+    /**
+     * @brief Objects drawn and culled by the last rendered frame
      */
-    void render();
+    const CullStats& getCullStats() const { return m_culler.getStats(); }
     
     /**
-     * @brief Initialize level with platforms
+     * @brief World sprite batch draw calls issued by the last rendered frame
+     */
+    std::size_t getDrawCallCount() const { return m_drawCalls; }
+    
+private:
+    /**
+     * @brief Process all input events (keyboard, mouse, window events)
      */
-    void initializeLevel();
+    void processEvents();
     
     /**
-     * @brief Handle collision between player and platforms
-     * @param deltaTime Time elapsed since last frame (used for moving platform carry)
+     * @brief Update game logic
+     * @param deltaTime Time elapsed since last frame in seconds
      */
-    void handlePlatformCollisions(float deltaTime);
+    void update(float deltaTime);
     
     /**
-     * @brief Handle hit detection between attacks and entities
+     * @brief Render all game objects
+     * @param alpha Blend between the previous (0) and current (1) tick state
      */
-    void handleCombat();
+    void render(float alpha = 1.f);
     
 private:
     sf::RenderWindow m_window;
     sf::Clock m_clock;
     
+    // Fixed timestep
+    bool m_fixedTimestep;
+    float m_tickDuration;
+    int m_maxCatchUpSteps;
+    float m_accumulator;
+    
+    // Render rate (frame cap and vsync are never applied together)
+    unsigned int m_frameRateLimit;
+    bool m_verticalSync;
+    
     // Game objects
-    std::unique_ptr<Player> m_player;
-    std::vector<Platform> m_platforms;
-    std::vector<std::unique_ptr<Enemy>> m_enemies;
-    std::unique_ptr<Boss> m_boss;  // Single boss for the level
-    std::unique_ptr<Camera> m_camera;
-    EffectsManager m_effectsManager;  // Visual effects system
+    std::unique_ptr<GameWorld> m_world;  // Simulation state
     std::unique_ptr<HUD> m_hud;  // UI display system
+    SpriteBatch m_spriteBatch;  // World geometry queued per frame, drawn in a few batches
+    ViewCuller m_culler;  // Skips world objects outside the camera view
+    std::size_t m_drawCalls;  // Sprite batch draw calls of the last frame
+    LevelGeometry m_levelGeometry;  // Static platforms, baked at level load
     
     // Concept art overlays
     std::vector<sf::Texture> m_conceptArtTextures;
@@ -84,5 +121,6 @@ private:
     // Game constants
     static constexpr unsigned int WINDOW_WIDTH = 1280;
     static constexpr unsigned int WINDOW_HEIGHT = 720;
-    static constexpr unsigned int FPS_LIMIT = 60;
+    static constexpr unsigned int DEFAULT_TICK_RATE = 120;
+    static constexpr int DEFAULT_MAX_CATCH_UP_STEPS = 8;
 };
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Player.hpp"
+#include "Platform.hpp"
+#include "PlatformGrid.hpp"
+#include "CollisionSystem.hpp"
+#include "EntityStore.hpp"
+#include "Camera.hpp"
+#include "Enemy.hpp"
+#include "AIScheduler.hpp"
+#include "ProjectileSystem.hpp"
+#include "SlotMap.hpp"
+#include "Boss.hpp"
+#include "EffectsManager.hpp"
+
+/**
+ * @brief Game simulation state, independent of any window
+ * 
+ * Owns the level, player, enemies, boss, camera and effects, and advances
+ * them one tick at a time (movement, AI, platform collisions, combat).
+ * Game drives it with real input and draws it; headless tools such as the
+ * simulation benchmark drive it with scripted input and never open a window.
+ */
+class GameWorld {
+public:
+    /**
+     * @param viewWidth Camera view width in pixels
+     * @param viewHeight Camera view height in pixels
+     */
+    GameWorld(float viewWidth, float viewHeight);
+    ~GameWorld() = default;
+    
+    GameWorld(const GameWorld&) = delete;
+    GameWorld& operator=(const GameWorld&) = delete;
+    
+    /**
+     * @brief Advance the simulation by one tick
+     * @param deltaTime Tick length in seconds
+     */
+    void update(float deltaTime);
+    
+    /**
+     * @brief Record current positions as the start of the next tick
+     * 
+     * update() calls this first; the saved positions drive render interpolation
+     * and the swept platform collision of this tick's moves.
+     */
+    void savePreviousState();
+    
+    /**
+     * @brief Move the player instantly, without interpolating across the jump
+     */
+    void teleportPlayer(const sf::Vector2f& position);
+    
+    /**
+     * @brief Add an enemy to the level
+     * @return Handle that goes stale once the enemy is despawned
+     */
+    SlotHandle spawnEnemy(const sf::Vector2f& position, float patrolRange, Enemy::EnemyType type);
+    
+    /**
+     * @brief Remove an enemy and its shots (no-op for stale handles)
+     */
+    void despawnEnemy(SlotHandle handle);
+    
+    /**
+     * @brief Enemy a handle refers to, or null once it has been despawned
+     */
+    Enemy* getEnemy(SlotHandle handle);
+    
+    // Accessors used by the renderer and tools
+    Player* getPlayer() { return m_player.get(); }
+    const Player* getPlayer() const { return m_player.get(); }
+    Boss* getBoss() { return m_boss.get(); }
+    const Boss* getBoss() const { return m_boss.get(); }
+    Camera* getCamera() { return m_camera.get(); }
+    std::vector<Platform>& getPlatforms() { return m_platforms; }
+    const std::vector<Platform>& getPlatforms() const { return m_platforms; }
+    SlotMap<std::unique_ptr<Enemy>>& getEnemies() { return m_enemies; }
+    const SlotMap<std::unique_ptr<Enemy>>& getEnemies() const { return m_enemies; }
+    AIScheduler& getAIScheduler() { return m_aiScheduler; }
+    ProjectileSystem& getProjectiles() { return m_projectiles; }
+    const ProjectileSystem& getProjectiles() const { return m_projectiles; }
+    EffectsManager& getEffectsManager() { return m_effectsManager; }
+    
+    /**
+     * @brief Changes whenever the level's platforms are rebuilt
+     *
+     * Renderers that bake static geometry compare it against their copy.
+     */
+    std::uint32_t getLevelRevision() const { return m_levelRevision; }
+    
+    // Level dimensions
+    static constexpr float LEVEL_WIDTH = 2560.f;
+    static constexpr float LEVEL_HEIGHT = 720.f;
+    
+private:
+    /**
+     * @brief Initialize level with platforms
+     */
+    void initializeLevel();
+    
+    /**
+     * @brief Handle collision between player and platforms
+     * @param deltaTime Time elapsed since last frame (used for moving platform carry)
+     */
+    void handlePlatformCollisions(float deltaTime);
+    
+    /**
+     * @brief Resolve grounded enemies and the boss against platforms in one pass
+     * @param deltaTime Tick length in seconds
+     */
+    void handleBodyCollisions(float deltaTime);
+    
+    /**
+     * @brief Destroy projectiles that hit solid or moving platforms this tick
+     */
+    void handleProjectileCollisions();
+    
+    /**
+     * @brief Handle hit detection between attacks and entities
+     */
+    void handleCombat();
+    
+    /**
+     * @brief Reclaim the slots of enemies killed this tick
+     */
+    void despawnDeadEnemies();
+    
+private:
+    EntityStore m_entityStore;  // Simulation state of every entity below; declared first so it outlives them
+    std::unique_ptr<Player> m_player;
+    std::vector<Platform> m_platforms;
+    std::uint32_t m_levelRevision = 0;  // Bumped each time the level is built (constructor)
+    PlatformGrid m_platformGrid;  // Broadphase over m_platforms, built at level load
+    std::vector<std::size_t> m_platformQuery;  // Reused query result buffer
+    CollisionSystem m_collisionSystem;  // Batched platform collision for enemies and boss
+    std::vector<CollisionBody> m_bodies;  // Reused collision batch
+    SlotMap<std::unique_ptr<Enemy>> m_enemies;  // Live enemies only, dead ones are despawned
+    AIScheduler m_aiScheduler;  // Distance-based AI level of detail for m_enemies
+    ProjectileSystem m_projectiles;  // Every enemy shot in the level
+    std::unique_ptr<Boss> m_boss;  // Single boss for the level
+    std::unique_ptr<Camera> m_camera;
+    EffectsManager m_effectsManager;  // Visual effects system
+};
@@ -1,20 +1,30 @@
 #pragma once
 
+#include "SpriteBatch.hpp"
+#include "ViewCuller.hpp"
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <string>
 
 class Player;
 class Boss;
 
 /**
  * @brief HUD system for displaying game UI elements
- * 
+ *
  * Shows player health, ability cooldowns, boss health, and status effects
+ *
+ * Retained mode: widgets are drawn into a window-sized render texture and
+ * only redrawn when their inputs change (health, cooldown fill in pixels,
+ * combo count, ...). Each frame then costs one textured quad for the cache
+ * plus one batched draw for the time-based pulses and rings on top.
  */
 class HUD {
 public:
     HUD(unsigned int windowWidth, unsigned int windowHeight);
-    
+
     /**
      * @brief Render all HUD elements
      * @param window Target render window
@@ -22,18 +32,86 @@ public:
      * @param boss Boss reference for health display
      */
     void render(sf::RenderWindow& window, const Player* player, const Boss* boss);
-    
+
+    /**
+     * @brief Force every widget to redraw next frame
+     */
+    void invalidate();
+
+    /**
+     * @brief World objects drawn and culled, and draw calls issued, by the frame being rendered
+     */
+    void setRenderStats(const CullStats& cullStats, std::size_t drawCalls);
+
+    /**
+     * @brief Show the render cost readout (bottom left; off by default)
+     */
+    void setShowRenderStats(bool show) { m_showRenderStats = show; }
+    bool isShowingRenderStats() const { return m_showRenderStats; }
+
 private:
+    // Independently cached widgets
+    enum class Widget {
+        PlayerHealth,
+        ParryCooldown,
+        SpiritCooldown,
+        EchoCooldown,
+        BossHealth,
+        Combo,
+        HeavyCharge,
+        Status,
+        RenderStats,
+        Count
+    };
+
+    using WidgetInputs = std::array<int, 4>;
+
+    // What a widget was last drawn from, and the cache area it covers
+    struct WidgetState {
+        WidgetInputs inputs{};
+        sf::FloatRect bounds;
+        bool valid = false;
+    };
+
     unsigned int m_windowWidth;
     unsigned int m_windowHeight;
     mutable sf::Font m_font;  // Would need actual font file in production
     bool m_fontLoaded;
-    
+
+    sf::RenderTexture m_cache;  // Retained widget pixels (premultiplied alpha)
+    bool m_cacheReady;  // False: draw every widget straight to the window each frame
+    bool m_cacheDirty;  // A widget changed since the last display()
+    std::array<WidgetState, static_cast<std::size_t>(Widget::Count)> m_widgets;
+    sf::FloatRect m_drawBounds;  // Area touched by the widget being drawn
+    SpriteBatch m_overlay;  // Per-frame pulses drawn over the cache
+
+    bool m_showRenderStats;
+    CullStats m_cullStats;
+    std::size_t m_drawCalls;
+
+    /**
+     * @brief Start redrawing a widget if its inputs changed
+     * @return False if the cached pixels are still current
+     */
+    bool beginWidget(Widget widget, const WidgetInputs& inputs);
+    void endWidget(Widget widget);
+
+    /**
+     * @brief Draw the parts of the HUD that never change
+     */
+    void drawChrome(sf::RenderTarget& target);
+
     // Helper methods
-    void drawCooldownBar(sf::RenderWindow& window, float x, float y, float width, float height,
-                        float remaining, float max, const sf::Color& color, const std::string& label);
-    void drawHealthBar(sf::RenderWindow& window, float x, float y, float width, float height,
+    void drawShape(sf::RenderTarget& target, const sf::Shape& shape);
+    void drawCooldownBar(sf::RenderTarget& target, float x, float y, float width, float height,
+                        float fillWidth, const sf::Color& color, const std::string& label);
+    void drawHealthBar(sf::RenderTarget& target, float x, float y, float width, float height,
                       int current, int max, const sf::Color& color, const std::string& label);
-    void drawText(sf::RenderWindow& window, const std::string& text, float x, float y,
+    void drawText(sf::RenderTarget& target, const std::string& text, float x, float y,
                  unsigned int size, const sf::Color& color);
+
+    // Animated outlines that change every frame
+    void addPulseBorder(float x, float y, float width, float height, float thickness, const sf::Color& color);
+
+    static float cooldownFillWidth(float remaining, float max, float width);
 };
@@ -0,0 +1,24 @@
+#pragma once
+
+/**
+ * @brief Snapshot of the player's controls for one simulation tick
+ * 
+ * The simulation only reads this struct, never the devices, so it can be
+ * driven by the keyboard/controller (poll) or by a script in headless tools.
+ */
+struct InputState {
+    float moveX = 0.f;          // -1 left, 0 none, 1 right
+    bool up = false;            // Aim up / ledge pull-up
+    bool down = false;          // Aim down
+    bool jump = false;
+    bool lightAttack = false;
+    bool heavyAttack = false;   // Hold to charge, release to fire
+    bool parry = false;
+    bool spiritStrike = false;
+    bool echoStep = false;
+    
+    /**
+     * @brief Read the keyboard and joystick 0
+     */
+    static InputState poll();
+};
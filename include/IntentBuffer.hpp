@@ -0,0 +1,63 @@
+#pragma once
+
+#include "ParticleWorld.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class Entity;
+class ProjectileSystem;
+
+/**
+ * @brief Spawns an entity asked for during a parallel update, applied later on one thread
+ *
+ * While an entity updates on a worker thread it must not write to the shared
+ * particle pool or projectile storage, so its emitters and weapons record
+ * what they would have spawned here instead. commit() then replays the
+ * requests in the order they were made.
+ *
+ * Usage: enemy.setIntentBuffer(&intents); (run enemy.update on any thread) ... intents.commit();
+ */
+class IntentBuffer {
+public:
+    void recordParticle(ParticleLayer layer, const sf::Vector2f& position, const sf::Vector2f& velocity,
+                        const sf::Color& color, float lifetime, float size, ParticleShape shape,
+                        bool glow, float rotationSpeed, bool trail);
+
+    void recordProjectile(ProjectileSystem& target, const sf::Vector2f& position, const sf::Vector2f& velocity,
+                          int damage, const sf::Color& color, const Entity* owner);
+
+    /**
+     * @brief Spawn everything recorded, in order, then empty the buffer (main thread only)
+     */
+    void commit();
+
+    void clear();
+    bool empty() const { return m_particles.empty() && m_projectiles.empty(); }
+
+private:
+    struct ParticleIntent {
+        ParticleLayer layer;
+        sf::Vector2f position;
+        sf::Vector2f velocity;
+        sf::Color color;
+        float lifetime;
+        float size;
+        ParticleShape shape;
+        bool glow;
+        float rotationSpeed;
+        bool trail;
+    };
+
+    struct ProjectileIntent {
+        ProjectileSystem* target;
+        sf::Vector2f position;
+        sf::Vector2f velocity;
+        int damage;
+        sf::Color color;
+        const Entity* owner;
+    };
+
+    // Particles and shots go to separate systems, so their relative order doesn't matter
+    std::vector<ParticleIntent> m_particles;
+    std::vector<ProjectileIntent> m_projectiles;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Platform.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Static level platforms baked into one GPU vertex buffer
+ *
+ * Solid and one-way platforms never move, so their geometry is written once
+ * when the level loads and drawn with a single call every frame. Moving
+ * platforms are skipped here and keep drawing through the sprite batch.
+ * Falls back to a CPU vertex array on drivers without vertex buffer support.
+ *
+ * Usage: if (geometry.isStale(world.getLevelRevision()))
+ *            geometry.build(world.getPlatforms(), world.getLevelRevision());
+ *        geometry.render(window);
+ */
+class LevelGeometry {
+public:
+    LevelGeometry();
+
+    /**
+     * @brief Re-bake every static platform
+     * @param levelRevision Revision of the level the platforms belong to
+     */
+    void build(const std::vector<Platform>& platforms, std::uint32_t levelRevision);
+
+    /**
+     * @brief Whether the baked geometry is from a different level revision
+     */
+    bool isStale(std::uint32_t levelRevision) const { return !m_built || m_revision != levelRevision; }
+
+    /**
+     * @brief Draw all static platforms (one draw call)
+     */
+    void render(sf::RenderTarget& target) const;
+
+    std::size_t getPlatformCount() const { return m_platformCount; }
+
+private:
+    sf::VertexBuffer m_buffer;
+    std::vector<sf::Vertex> m_fallback;  // Used when vertex buffers are unavailable
+    std::size_t m_vertexCount;
+    std::size_t m_platformCount;
+    std::uint32_t m_revision;
+    bool m_built;
+};
@@ -0,0 +1,95 @@
+#pragma once
+#include "ParticleWorld.hpp"
+#include <SFML/Graphics.hpp>
+
+class IntentBuffer;
+
+enum class ParticleQuality {
+    Low,
+    Medium,
+    High
+};
+
+/**
+ * @brief Lightweight emitter handle owned by an entity
+ *
+ * Holds no particles itself: every emit call spawns into the shared
+ * ParticleWorld on this emitter's draw layer, scaled by its quality setting.
+ * While an intent buffer is set, spawns are recorded there instead so the
+ * owner can update off the main thread.
+ */
+class ParticleEmitter {
+public:
+    explicit ParticleEmitter(ParticleLayer layer = ParticleLayer::AboveEntities);
+
+    void setLayer(ParticleLayer layer) { m_layer = layer; }
+    ParticleLayer getLayer() const { return m_layer; }
+
+    // Trails cost a pool slot per particle; disable for emitters whose particles barely move
+    void setTrailsEnabled(bool enabled) { m_trailsEnabled = enabled; }
+    bool areTrailsEnabled() const { return m_trailsEnabled; }
+
+    // Record spawns into a buffer instead of the shared ParticleWorld (null: spawn directly)
+    void setIntentBuffer(IntentBuffer* intents) { m_intents = intents; }
+
+    // Reseed this emitter's generator (e.g. to replay an effect exactly)
+    void setSeed(std::uint64_t seed) { m_random.seed(seed); }
+
+    void setQuality(ParticleQuality quality);
+    ParticleQuality getQuality() const { return m_quality; }
+    
+    void emit(const sf::Vector2f& position, int count, const sf::Color& color, 
+              float speed = 150.f, float lifetime = 0.5f, float size = 3.f);
+    
+    void emitBurst(const sf::Vector2f& position, int count, const sf::Color& color,
+                   float minSpeed, float maxSpeed, float lifetime, float size);
+    
+    void emitDirectional(const sf::Vector2f& position, const sf::Vector2f& direction,
+                        int count, const sf::Color& color, float spread = 30.f,
+                        float speed = 200.f, float lifetime = 0.4f, float size = 4.f);
+    
+    // New enhanced particle emitters
+    void emitSparks(const sf::Vector2f& position, int count, const sf::Color& color,
+                    float speed = 250.f, float lifetime = 0.3f);
+    
+    void emitGlow(const sf::Vector2f& position, int count, const sf::Color& color,
+                  float speed = 80.f, float lifetime = 0.8f, float size = 8.f);
+    
+    void emitExplosion(const sf::Vector2f& position, const sf::Color& color,
+                      int ringCount = 3, int particlesPerRing = 12);
+    
+    void emitTrail(const sf::Vector2f& position, const sf::Color& color,
+                   int count = 5, float size = 4.f);
+    
+    void emitRing(const sf::Vector2f& position, const sf::Color& color,
+                  float radius = 50.f, int segments = 16);
+    
+private:
+    ParticleLayer m_layer;
+    bool m_trailsEnabled;
+    FastRandom m_random;
+    ParticleQuality m_quality;
+    float m_qualityScale;
+    IntentBuffer* m_intents;
+
+    /**
+     * @brief Ranges for particles flying out in random directions
+     */
+    struct RadialParams {
+        float minSpeed, maxSpeed;
+        float minLifetime, maxLifetime;
+        float minSize, maxSize;
+        ParticleShape shape = ParticleShape::Circle;
+        bool glow = false;
+        float maxRotationSpeed = 0.f;  // Rotation drawn from [-max, max)
+    };
+
+    // Random values are generated a batch at a time into stack buffers
+    static constexpr int EMIT_BATCH = 32;
+
+    int scaleCount(int count) const;
+    void emitRadial(const sf::Vector2f& position, int count, const sf::Color& color, const RadialParams& params);
+    void spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, const sf::Color& color,
+               float lifetime, float size, ParticleShape shape = ParticleShape::Circle,
+               bool glow = false, float rotationSpeed = 0.f);
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include "ParticleStore.hpp"
+#include "ViewCuller.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+/**
+ * @brief Batched renderer for a ParticleStore
+ *
+ * Writes every particle (glow, body and trail) into two pre-sized vertex
+ * buffers - one triangle list and one line list for trails - so a whole
+ * store is drawn in two draw calls instead of one or more per particle.
+ * Shape outlines come from precomputed unit-polygon tables. Particles
+ * outside the culler's view are skipped before any vertices are built.
+ */
+class ParticleRenderer {
+public:
+    ParticleRenderer();
+
+    void render(sf::RenderTarget& target, const ParticleStore& particles, ViewCuller& culler);
+
+    // Unit polygon resolution (CircleShape uses 30, which is overkill at particle sizes)
+    static constexpr std::size_t CIRCLE_SEGMENTS = 16;
+    static constexpr std::size_t STAR_POINTS = 5;
+    static constexpr float GLOW_SCALE = 2.5f;
+    static constexpr float RING_THICKNESS = 2.f;
+
+private:
+    sf::VertexArray m_triangles;
+    sf::VertexArray m_trails;
+    std::vector<std::size_t> m_visible;  // Indices that passed culling this frame
+
+    static std::size_t countTriangleVertices(const ParticleStore& particles, std::size_t index);
+    static std::size_t countTrailVertices(const ParticleStore& particles, std::size_t index);
+    std::size_t writeParticle(const ParticleStore& particles, std::size_t index, std::size_t offset);
+    std::size_t writeTrail(const ParticleStore& particles, std::size_t index, std::size_t offset);
+};
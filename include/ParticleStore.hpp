@@ -0,0 +1,119 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+enum class ParticleShape : std::uint8_t {
+    Circle,
+    Square,
+    Star,
+    Spark,
+    Ring
+};
+
+/**
+ * @brief Structure-of-arrays particle storage
+ *
+ * Hot simulation data (position, velocity, lifetime, size, rotation) lives in
+ * separate contiguous arrays so the integration kernel can stream through it
+ * with SIMD loads. Colour, shape, glow and trail data are only read when
+ * rendering and are kept in their own arrays so the update never touches them.
+ *
+ * Trails are opt-in: particles that want one get a slot in a pool of
+ * fixed-size position rings, recycled through a free list, so particles
+ * without trails pay only a slot index and nothing allocates per frame.
+ *
+ * Integration rules per particle (in order):
+ *   position += velocity * dt, lifetime -= dt
+ *   sparks and stars shrink with the remaining life ratio
+ *   gravity (400 px/s², sparks 100 px/s²), then 0.98 air resistance
+ */
+class ParticleStore {
+public:
+    ParticleStore() = default;
+
+    void spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, const sf::Color& color,
+               float lifetime, float size, ParticleShape shape = ParticleShape::Circle,
+               bool glow = false, float rotationSpeed = 0.f, bool trail = true);
+
+    /**
+     * @brief Advance every particle by deltaTime (SIMD when available)
+     */
+    void integrate(float deltaTime);
+
+    /**
+     * @brief Drop expired particles, preserving the order of the survivors
+     */
+    void removeDead();
+
+    void reserve(std::size_t capacity);
+    void clear();
+    std::size_t size() const { return m_positionX.size(); }
+    bool empty() const { return m_positionX.empty(); }
+
+    // Per-particle accessors used by the renderer
+    sf::Vector2f getPosition(std::size_t i) const { return {m_positionX[i], m_positionY[i]}; }
+    sf::Vector2f getVelocity(std::size_t i) const { return {m_velocityX[i], m_velocityY[i]}; }
+    float getSize(std::size_t i) const { return m_size[i]; }
+    float getRotation(std::size_t i) const { return m_rotation[i]; }
+    float getLifeRatio(std::size_t i) const { return m_lifetime[i] / m_maxLifetime[i]; }
+    ParticleShape getShape(std::size_t i) const { return m_shape[i]; }
+    bool hasGlow(std::size_t i) const { return m_glow[i] != 0; }
+    bool hasTrail(std::size_t i) const { return m_trailSlot[i] != NO_TRAIL; }
+    std::size_t getTrailLength(std::size_t i) const;
+
+    /**
+     * @brief Trail point k of particle i, oldest first (k < getTrailLength(i))
+     */
+    sf::Vector2f getTrailPoint(std::size_t i, std::size_t k) const;
+
+    /**
+     * @brief Spawn colour with alpha faded by the remaining lifetime
+     */
+    sf::Color getColor(std::size_t i) const;
+
+    static constexpr std::size_t MAX_TRAIL_LENGTH = 8;  // Must be a power of two
+
+private:
+    static constexpr std::uint32_t NO_TRAIL = 0xFFFFFFFFu;
+    static constexpr std::size_t TRAIL_MASK = MAX_TRAIL_LENGTH - 1;
+    static_assert((MAX_TRAIL_LENGTH & TRAIL_MASK) == 0, "MAX_TRAIL_LENGTH must be a power of two");
+
+    /**
+     * @brief Last MAX_TRAIL_LENGTH positions of a particle, overwritten in place
+     */
+    struct TrailRing {
+        std::array<sf::Vector2f, MAX_TRAIL_LENGTH> points;
+        std::uint8_t head = 0;   // Next slot to write
+        std::uint8_t count = 0;  // Valid points (saturates at MAX_TRAIL_LENGTH)
+    };
+
+    // Hot data - touched by integrate() every frame
+    std::vector<float> m_positionX;
+    std::vector<float> m_positionY;
+    std::vector<float> m_velocityX;
+    std::vector<float> m_velocityY;
+    std::vector<float> m_lifetime;
+    std::vector<float> m_maxLifetime;
+    std::vector<float> m_size;
+    std::vector<float> m_rotation;
+    std::vector<float> m_rotationSpeed;
+    std::vector<float> m_gravity;        // Per-shape gravity, resolved at spawn
+    std::vector<std::uint32_t> m_shrink; // All bits set for shapes that shrink (SIMD select mask)
+
+    // Cold data - only read when rendering
+    std::vector<sf::Color> m_color;
+    std::vector<ParticleShape> m_shape;
+    std::vector<std::uint8_t> m_glow;
+    std::vector<std::uint32_t> m_trailSlot;  // Index into m_trails, or NO_TRAIL
+
+    // Trail pool shared by every particle in the store
+    std::vector<TrailRing> m_trails;
+    std::vector<std::uint32_t> m_freeTrails;
+
+    void integrateScalar(std::size_t begin, std::size_t end, float deltaTime);
+    void recordTrails();
+    std::uint32_t acquireTrail();
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include "ParticleStore.hpp"
+#include "ParticleRenderer.hpp"
+#include "FastRandom.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+
+/**
+ * @brief Draw layer a particle belongs to
+ */
+enum class ParticleLayer {
+    BehindEntities,  // Drawn after platforms, before enemies/boss/player
+    AboveEntities,   // Drawn after the player, before screen effects
+    Count
+};
+
+/**
+ * @brief Singleton owner of every live particle in the game
+ *
+ * Entities hold lightweight ParticleEmitter handles that spawn into this
+ * shared pool. Storage grows with the number of live particles only and is
+ * capped by a global budget; spawns beyond the budget are dropped.
+ *
+ * Usage: ParticleWorld::getInstance().update(dt) once per tick, then
+ *        render(window, layer, culler) at the matching point in the draw order.
+ */
+class ParticleWorld {
+public:
+    // Singleton access
+    static ParticleWorld& getInstance();
+
+    // Delete copy constructor and assignment (singleton pattern)
+    ParticleWorld(const ParticleWorld&) = delete;
+    ParticleWorld& operator=(const ParticleWorld&) = delete;
+
+    /**
+     * @brief Add a particle to a layer
+     * @return false if the global budget is exhausted
+     */
+    bool spawn(ParticleLayer layer, const sf::Vector2f& position, const sf::Vector2f& velocity,
+               const sf::Color& color, float lifetime, float size,
+               ParticleShape shape = ParticleShape::Circle, bool glow = false, float rotationSpeed = 0.f,
+               bool trail = true);
+
+    void update(float deltaTime);
+    void render(sf::RenderTarget& target, ParticleLayer layer, ViewCuller& culler);
+    void clear();
+
+    std::size_t getParticleCount() const;
+    std::size_t getParticleCount(ParticleLayer layer) const;
+
+    /**
+     * @brief Seed for the next emitter created
+     *
+     * Seeds are derived from a counter, so the same construction order
+     * yields the same particle streams. setSeed restarts the sequence.
+     */
+    std::uint64_t nextEmitterSeed() { return FastRandom::splitMix64(m_seedState); }
+    void setSeed(std::uint64_t seed) { m_seedState = seed; }
+
+    // Global particle budget across all layers
+    static constexpr std::size_t MAX_PARTICLES = 6000;
+
+private:
+    ParticleWorld() = default;
+    ~ParticleWorld() = default;
+
+    static constexpr std::size_t LAYER_COUNT = static_cast<std::size_t>(ParticleLayer::Count);
+
+    std::array<ParticleStore, LAYER_COUNT> m_layers;
+    std::array<ParticleRenderer, LAYER_COUNT> m_renderers;
+    std::uint64_t m_seedState = 0;
+};
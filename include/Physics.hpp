@@ -44,4 +44,25 @@ namespace Physics {
      * @return Clamped velocity
      */
     sf::Vector2f clampVelocity(const sf::Vector2f& velocity, float maxSpeed);
+    
+    /**
+     * @brief First contact found by a swept AABB test
+     */
+    struct SweepHit {
+        bool hit = false;
+        float time = 1.f;  // Fraction of the displacement covered before contact (0-1)
+        sf::Vector2f normal;  // Outward normal of the target face that was hit
+    };
+    
+    /**
+     * @brief Swept AABB collision (time of impact)
+     * 
+     * Finds when a box moving in a straight line first touches a static box,
+     * so movers that cross a thin target within one tick still hit it.
+     * @param box Moving box at the start of the move
+     * @param displacement Distance travelled this tick
+     * @param target Static box
+     * @return Contact time and face normal; no hit if the boxes already overlap at the start
+     */
+    SweepHit sweepAABB(const sf::FloatRect& box, const sf::Vector2f& displacement, const sf::FloatRect& target);
 }
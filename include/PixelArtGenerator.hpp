@@ -1,13 +1,47 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 
 /**
  * @brief Generates high-quality pixel art sprites in a consistent aesthetic
  * Designed to match Nine Sols' visual style with hand-drawn pixel art quality
+ * 
+ * draw*SpriteSheet() only builds the image (frame rows are drawn in parallel
+ * on the ThreadPool) and is safe to call from any thread. create*SpriteSheet()
+ * also uploads it, so it must run on the main thread.
  */
 namespace PixelArtGenerator {
     
+    /**
+     * Art revision, part of the sprite sheet disk cache key
+     * Bump it whenever a sheet's drawing changes so stale caches are regenerated
+     */
+    constexpr std::uint32_t VERSION = 1;
+    
+    // Animation frame grid of each sheet
+    constexpr int PLAYER_FRAME_WIDTH = 128;
+    constexpr int PLAYER_FRAME_HEIGHT = 40;
+    constexpr int ENEMY_FRAME_WIDTH = 80;
+    constexpr int ENEMY_FRAME_HEIGHT = 64;
+    constexpr int BOSS_FRAME_WIDTH = 80;
+    constexpr int BOSS_FRAME_HEIGHT = 64;
+    
+    /**
+     * Draw the player sprite sheet image (1024x320)
+     */
+    sf::Image drawPlayerSpriteSheet();
+    
+    /**
+     * Draw the enemy sprite sheet image (640x320)
+     */
+    sf::Image drawEnemySpriteSheet();
+    
+    /**
+     * Draw the boss sprite sheet image (640x320)
+     */
+    sf::Image drawBossSpriteSheet();
+    
     /**
      * Create a detailed player sprite sheet (512x256)
      * 8 rows × 8 frames = 64 animation frames total
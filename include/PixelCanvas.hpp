@@ -0,0 +1,80 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief CPU-side RGBA8 drawing surface for procedural sprite generation
+ *
+ * Pixels live in one contiguous buffer in sf::Image byte order. Every
+ * operation clips its rectangle to the canvas once and then works on whole
+ * row spans, so inner loops carry no bounds checks and compile to plain
+ * vectorisable fills/blends. Convert to an sf::Image once drawing is done.
+ *
+ * A canvas can cover just part of a larger sheet (its origin), taking draw
+ * calls in sheet coordinates. Separate threads can draw separate parts and
+ * blit them into the full sheet afterwards.
+ */
+class PixelCanvas {
+public:
+    /**
+     * @param width Canvas width in pixels
+     * @param height Canvas height in pixels
+     * @param background Initial color of every pixel
+     * @param origin Sheet coordinates of this canvas's top-left pixel
+     */
+    PixelCanvas(unsigned int width, unsigned int height, const sf::Color& background = sf::Color::Transparent,
+                const sf::Vector2i& origin = sf::Vector2i(0, 0));
+
+    /**
+     * @brief Overwrite a rectangle with a solid color (clipped to the canvas)
+     */
+    void fillRect(int x, int y, int width, int height, const sf::Color& color);
+
+    /**
+     * @brief Overwrite one pixel (ignored outside the canvas)
+     */
+    void setPixel(int x, int y, const sf::Color& color);
+
+    /**
+     * @brief Blend a color into a rectangle (clipped to the canvas)
+     *
+     * Each channel becomes the average of the existing and new color; alpha
+     * keeps the larger of the two, so soft glows never punch holes.
+     */
+    void blendRect(int x, int y, int width, int height, const sf::Color& color);
+
+    /**
+     * @brief Blend a color into one pixel (ignored outside the canvas)
+     */
+    void blendPixel(int x, int y, const sf::Color& color);
+
+    /**
+     * @brief Copy another canvas over the area it covers (clipped to this canvas)
+     */
+    void blit(const PixelCanvas& source);
+
+    /**
+     * @brief Copy the finished canvas into an image for texture upload
+     */
+    sf::Image toImage() const;
+
+    unsigned int getWidth() const { return m_width; }
+    unsigned int getHeight() const { return m_height; }
+    const sf::Vector2i& getOrigin() const { return m_origin; }
+
+private:
+    /**
+     * @brief Clip a rectangle in sheet coordinates to the canvas
+     * @return False if nothing is left to draw; otherwise x/y are local to the buffer
+     */
+    bool clip(int& x, int& y, int& width, int& height) const;
+
+    static std::uint32_t pack(const sf::Color& color);
+
+    unsigned int m_width;
+    unsigned int m_height;
+    sf::Vector2i m_origin;
+    std::vector<std::uint32_t> m_pixels;  // One RGBA8 pixel per element, row-major
+};
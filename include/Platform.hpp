@@ -2,6 +2,8 @@
 
 #include <SFML/Graphics.hpp>
 
+class SpriteBatch;
+
 /**
  * @brief Platform/tile class for level geometry
  * 
@@ -33,9 +35,27 @@ public:
              float moveSpeed = 0.f);
     ~Platform() = default;
     
-    void render(sf::RenderWindow& window) const;
+    /**
+     * @brief Queue the platform for drawing
+     * @param alpha Blend between the previous (0) and current (1) tick position
+     */
+    void render(SpriteBatch& batch, float alpha = 1.f) const;
     void update(float deltaTime);
     
+    /**
+     * @brief Write the platform's fill and outline as a triangle list
+     * @param out Room for VERTEX_COUNT vertices
+     * @param alpha Blend between the previous (0) and current (1) tick position
+     */
+    void writeVertices(sf::Vertex* out, float alpha = 1.f) const;
+    
+    // Fill quad plus four outline strips, two triangles each
+    static constexpr std::size_t VERTEX_COUNT = 30;
+    static constexpr float OUTLINE_THICKNESS = 2.f;
+    
+    // Remember the current position as the start of the next tick
+    void savePreviousState() { m_prevPosition = m_position; }
+    
     sf::FloatRect getBounds() const;
     
     // Getters
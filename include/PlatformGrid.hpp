@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Platform.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Uniform-grid broadphase over level platforms
+ * 
+ * Static platforms (Solid/OneWay) are bucketed once at level load into a
+ * compact cell table. Moving platforms live in separate dynamic buckets that
+ * are rebuilt each tick with refreshDynamic(). A query only visits the cells
+ * under the requested area, so its cost depends on nearby geometry rather
+ * than level size.
+ * 
+ * Areas outside the grid clamp to the border cells, so platforms that move
+ * past the original level bounds are still found.
+ */
+class PlatformGrid {
+public:
+    explicit PlatformGrid(float cellSize = DEFAULT_CELL_SIZE);
+    
+    /**
+     * @brief Bucket every platform (call after the level is built)
+     */
+    void build(const std::vector<Platform>& platforms);
+    
+    /**
+     * @brief Re-bucket moving platforms at their current positions
+     */
+    void refreshDynamic(const std::vector<Platform>& platforms);
+    
+    /**
+     * @brief Collect indices of platforms whose cells overlap an area
+     * @param area World-space region to test
+     * @param out Receives candidate indices, sorted ascending and unique
+     * 
+     * Candidates may not actually intersect the area; callers still run the
+     * exact test. Sorted output keeps results in level order.
+     */
+    void query(const sf::FloatRect& area, std::vector<std::size_t>& out) const;
+    
+    /**
+     * @brief Key identifying the block of cells an area covers
+     * 
+     * Areas with equal keys get identical query results, so sorting by key
+     * groups bodies that can share one query.
+     */
+    std::uint64_t cellKey(const sf::FloatRect& area) const;
+    
+    static constexpr float DEFAULT_CELL_SIZE = 128.f;
+    
+private:
+    struct CellRange {
+        int minX, minY, maxX, maxY;
+    };
+    
+    CellRange cellsFor(const sf::FloatRect& bounds) const;
+    std::size_t cellIndex(int x, int y) const { return static_cast<std::size_t>(y) * m_columns + x; }
+    
+    float m_cellSize;
+    sf::Vector2f m_origin;
+    int m_columns;
+    int m_rows;
+    
+    // Static cells in compressed form: cell c owns m_staticIndices[m_cellStart[c] .. m_cellStart[c + 1])
+    std::vector<std::uint32_t> m_cellStart;
+    std::vector<std::uint32_t> m_staticIndices;
+    
+    // Moving platforms, rebuilt every tick
+    std::vector<std::uint32_t> m_movingPlatforms;
+    std::vector<std::vector<std::uint32_t>> m_dynamicCells;
+    std::vector<std::size_t> m_dirtyCells;  // Dynamic cells to clear on the next refresh
+};
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Entity.hpp"
-#include "Attack.hpp"
+#include "AttackPool.hpp"
 #include "Animation.hpp"
-#include "ParticleSystem.hpp"
+#include "ParticleEmitter.hpp"
+#include "TextureAtlas.hpp"
+#include "Input.hpp"
 #include <SFML/Graphics.hpp>
 #include <optional>
 #include <memory>
@@ -16,13 +18,14 @@
  */
 class Player : public Entity {
 public:
-    Player();
+    explicit Player(EntityStore& store);
     ~Player() override = default;
     
     void update(float deltaTime) override;
-    void render(sf::RenderWindow& window) const override;
+    void render(SpriteBatch& batch) const override;
     
     // Input handling
+    void setInput(const InputState& input) { m_input = input; }
     void handleInput();
     
     // Player-specific methods
@@ -33,7 +36,7 @@ public:
     // Wall mechanics
     void setOnWall(bool onWall, bool wallOnRight);
     bool isOnWall() const { return m_onWall; }
-    bool isWallSliding() const { return m_onWall && !m_onGround && m_velocity.y > 0; }
+    bool isWallSliding() const { return m_onWall && !m_onGround && m_body->velocity.y > 0; }
     
     // Ledge grab mechanics
     void setOnLedge(bool onLedge, const sf::Vector2f& ledgePos);
@@ -53,7 +56,7 @@ public:
     bool isPerfectParryWindow() const { return m_isParrying && m_parryElapsed <= PARRY_PERFECT_WINDOW; }
     bool isSpiritStrikeActive() const { return m_spiritStrikeActive; }
     bool isEchoStepping() const { return m_echoActive; }
-    bool isInvulnerable() const { return m_invulnerable; }
+    bool isInvulnerable() const { return m_vitals->invulnerable; }
     // Combo getters
     int getComboCount() const { return m_comboCount; }
     float getComboTimer() const { return m_comboTimer; }
@@ -67,7 +70,7 @@ public:
     float getSpiritStrikeCooldownMax() const { return SPIRIT_STRIKE_COOLDOWN_TIME; }
     float getEchoStepCooldown() const { return m_echoCooldown; }
     float getEchoStepCooldownMax() const { return ECHO_STEP_COOLDOWN; }
-    const std::vector<std::unique_ptr<Attack>>& getActiveAttacks() const { return m_activeAttacks; }
+    const AttackPool& getActiveAttacks() const { return m_attacks; }
     
 private:
     // Movement constants
@@ -94,7 +97,14 @@ private:
     float m_wallSlideTimer;  // Timer for wall slide grace period
     
     // Input state
+    InputState m_input;  // Controls for the current tick (set by Game or a script)
     float m_inputDirection;  // -1 (left), 0 (none), 1 (right)
+    bool m_wasJumpPressed;  // Previous-tick button states for press/release detection
+    bool m_wasLightAttackPressed;
+    bool m_wasHeavyAttackPressed;
+    bool m_wasParryPressed;
+    bool m_wasSpiritStrikePressed;
+    bool m_wasEchoPressed;
     
     // Combat state
     bool m_isAttacking;
@@ -125,7 +135,7 @@ private:
     static constexpr float PARRY_DURATION = 0.35f;   // Slightly longer active window for reliability
     static constexpr float PARRY_COOLDOWN = 0.60f;    // Faster reset to encourage use
     static constexpr float PARRY_PERFECT_WINDOW = 0.12f;  // First 120ms is perfect parry
-    std::vector<std::unique_ptr<Attack>> m_activeAttacks;
+    AttackPool m_attacks;  // Live swings, fixed capacity (no allocation per attack)
     
     // Spirit Strike ability
     bool m_spiritStrikeActive;
@@ -162,9 +172,9 @@ private:
     static constexpr float COYOTE_TIME = 0.13f;  // ~8 frames at 60fps grace period
     static constexpr float JUMP_INPUT_BUFFER = 0.08f;  // ~5 frames buffer window
     mutable std::optional<sf::Sprite> m_sprite;  // optional because SFML 3 sprite needs texture
-    sf::Texture m_texture;  // Sprite sheet texture
+    AtlasRegion m_sheet;  // Sprite sheet in the shared atlas (no texture when headless)
     AnimationController m_animController;
-    mutable ParticleSystem m_particles;  // mutable for const render method
+    mutable ParticleEmitter m_particles;  // mutable: render() emits ambient particles
     
     // Animation state
     enum class AnimState {
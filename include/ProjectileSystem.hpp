@@ -0,0 +1,94 @@
+#pragma once
+
+#include "ParticleEmitter.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+class Entity;
+class SpriteBatch;
+class ViewCuller;
+
+/**
+ * @brief Every live enemy shot in the level, stored as structure-of-arrays
+ *
+ * Position, velocity and lifetime sit in their own contiguous arrays so the
+ * per-tick integration streams through them; damage, owner and colour are
+ * only read by collision and rendering. Storage is reserved up front for
+ * MAX_PROJECTILES shots, so firing never allocates.
+ *
+ * A shot is alive while its lifetime is positive. deactivate() zeroes the
+ * lifetime and the next update() drops it, keeping the survivors in firing
+ * order so collision and draw order stay deterministic.
+ *
+ * Usage: projectiles.spawn(muzzle, direction * 300.f, damage, color, this);
+ *        for (std::size_t i = 0; i < projectiles.size(); ++i) test(projectiles.getBounds(i));
+ */
+class ProjectileSystem {
+public:
+    ProjectileSystem();
+
+    /**
+     * @brief Fire a shot
+     * @param owner Entity that fired it; its shots vanish when it dies
+     * @return False if the level is at MAX_PROJECTILES (the shot is dropped)
+     */
+    bool spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, int damage,
+               const sf::Color& color, const Entity* owner);
+
+    /**
+     * @brief Drop deactivated shots, then move and age the rest and emit their trails
+     */
+    void update(float deltaTime);
+
+    /**
+     * @brief Queue every visible shot as one batch of triangles
+     */
+    void render(SpriteBatch& batch, ViewCuller& culler);
+
+    /**
+     * @brief Remove an entity's shots before it goes away
+     */
+    void releaseOwnedBy(const Entity* owner);
+
+    void clear();
+    std::size_t size() const { return m_positionX.size(); }
+    bool empty() const { return m_positionX.empty(); }
+
+    // Per-shot accessors used by collision
+    bool isActive(std::size_t i) const { return m_lifetime[i] > 0.f; }
+    void deactivate(std::size_t i) { m_lifetime[i] = 0.f; }
+    sf::FloatRect getBounds(std::size_t i) const;
+    sf::FloatRect getPreviousBounds(std::size_t i) const;  // Bounds at the start of the current tick
+    int getDamage(std::size_t i) const { return m_damage[i]; }
+    const Entity* getOwner(std::size_t i) const { return m_owner[i]; }
+
+    static constexpr std::size_t MAX_PROJECTILES = 512;
+    static constexpr float RADIUS = 6.f;
+    static constexpr float OUTLINE_THICKNESS = 2.f;
+    static constexpr float LIFETIME = 3.0f;
+    static constexpr std::size_t CIRCLE_SEGMENTS = 16;
+    static constexpr std::size_t VERTICES_PER_SHOT = (CIRCLE_SEGMENTS - 2) * 3 + CIRCLE_SEGMENTS * 6;
+
+private:
+    void removeInactive();
+
+    // Simulation data
+    std::vector<float> m_positionX;
+    std::vector<float> m_positionY;
+    std::vector<float> m_previousX;
+    std::vector<float> m_previousY;
+    std::vector<float> m_velocityX;
+    std::vector<float> m_velocityY;
+    std::vector<float> m_lifetime;
+
+    // Collision and render data
+    std::vector<int> m_damage;
+    std::vector<const Entity*> m_owner;
+    std::vector<sf::Color> m_color;
+
+    std::array<sf::Vertex, VERTICES_PER_SHOT> m_shotTemplate;  // One shot around the origin
+    std::vector<sf::Vertex> m_vertices;  // Reused render buffer
+    ParticleEmitter m_trail{ParticleLayer::BehindEntities};  // Shared by every shot
+};
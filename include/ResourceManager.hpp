@@ -2,9 +2,23 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include "SpriteSheetCache.hpp"
+#include "TextureAtlas.hpp"
+#include <future>
 #include <map>
 #include <string>
 #include <memory>
+#include <utility>
+
+/**
+ * @brief Procedurally generated sprite sheets shared through ResourceManager
+ */
+enum class SpriteSheetKind {
+    Player,
+    Enemy,
+    Boss,
+    Count
+};
 
 /**
  * @brief Singleton resource manager for loading and caching game assets
@@ -38,14 +52,51 @@ public:
     sf::SoundBuffer& getSoundBuffer(const std::string& id);
     bool hasSoundBuffer(const std::string& id) const;
     
+    /**
+     * @brief Get a generated sprite sheet's region in the shared sprite atlas
+     * 
+     * The first request packs every generated sheet into one atlas page, so
+     * the player, enemies and boss all draw from the same texture. The page
+     * is freed when the last region referencing it is released, and rebuilt
+     * on the next request. Images come from the disk cache (cache/sprites
+     * next to the executable) when it matches the current art, and are drawn and written back to it
+     * otherwise.
+     * @return Region on its atlas page; in headless mode the texture is null
+     *         but the frame grid is still valid
+     */
+    AtlasRegion acquireSpriteSheet(SpriteSheetKind kind);
+    
+    /**
+     * @brief Start drawing a sprite sheet on the ThreadPool ahead of time
+     * 
+     * The next acquireSpriteSheet() for this kind waits for that image instead
+     * of drawing it again, then uploads it on the calling (main) thread.
+     */
+    void prefetchSpriteSheet(SpriteSheetKind kind);
+    
     // Clear all resources
     void clear();
     
+    // Headless mode: no window or GPU context, so entities skip texture creation
+    void setHeadless(bool headless) { m_headless = headless; }
+    bool isHeadless() const { return m_headless; }
+    
 private:
-    ResourceManager() = default;
+    ResourceManager();
     ~ResourceManager() = default;
     
     std::map<std::string, std::unique_ptr<sf::Texture>> m_textures;
     std::map<std::string, std::unique_ptr<sf::Font>> m_fonts;
     std::map<std::string, std::unique_ptr<sf::SoundBuffer>> m_soundBuffers;
+    // Atlas placement of a sheet; not owning, the regions handed out keep pages alive
+    struct CachedSheet {
+        std::weak_ptr<const sf::Texture> page;
+        sf::IntRect bounds;
+        sf::Vector2i frameSize;
+    };
+    
+    std::map<SpriteSheetKind, CachedSheet> m_spriteSheets;
+    std::map<SpriteSheetKind, std::future<sf::Image>> m_pendingSheets;  // Prefetched images still being drawn
+    SpriteSheetCache m_sheetCache;  // Generated images from earlier runs
+    bool m_headless = false;
 };
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Reference to a SlotMap element that goes stale when the element is erased
+ *
+ * The slot's generation changes every time it is reused, so an old handle can
+ * never reach a newer element that happens to sit in the same slot.
+ */
+struct SlotHandle {
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+    bool operator==(const SlotHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+
+    static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+};
+
+/**
+ * @brief Growable container with O(1) insert/erase and generation-checked handles
+ *
+ * Values are kept packed in one vector, so iteration only ever visits live
+ * elements. Erasing moves the last value into the hole (iteration order is
+ * not stable across erases). Handles go through a slot table that maps them
+ * to the value's current packed position; freed slots are reused from a
+ * free list and their generation is bumped.
+ *
+ * Usage: SlotHandle id = enemies.insert(std::make_unique<Enemy>(...));
+ *        for (auto& enemy : enemies) enemy->update(dt);
+ *        enemies.erase(id);
+ */
+template <typename T>
+class SlotMap {
+public:
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    SlotHandle insert(T value);
+
+    /**
+     * @brief Remove an element (no-op for stale handles)
+     * @return True if the element was live
+     */
+    bool erase(SlotHandle handle);
+
+    /**
+     * @brief Remove every element the predicate accepts
+     * @return Number of elements removed
+     */
+    template <typename Predicate>
+    std::size_t eraseIf(Predicate predicate);
+
+    /**
+     * @brief Element a handle refers to, or null if it was erased
+     */
+    T* get(SlotHandle handle);
+    const T* get(SlotHandle handle) const;
+    bool contains(SlotHandle handle) const { return get(handle) != nullptr; }
+
+    /**
+     * @brief Handle of the element at a packed position (0 <= i < size())
+     */
+    SlotHandle handleAt(std::size_t i) const;
+
+    void clear();
+    void reserve(std::size_t capacity);
+    std::size_t size() const { return m_values.size(); }
+    bool empty() const { return m_values.empty(); }
+
+    // Dense iteration over live elements
+    iterator begin() { return m_values.begin(); }
+    iterator end() { return m_values.end(); }
+    const_iterator begin() const { return m_values.begin(); }
+    const_iterator end() const { return m_values.end(); }
+    T& operator[](std::size_t i) { return m_values[i]; }
+    const T& operator[](std::size_t i) const { return m_values[i]; }
+
+private:
+    struct Slot {
+        std::uint32_t dense = 0;  // Position in m_values while live
+        std::uint32_t generation = 0;
+    };
+
+    void eraseAt(std::size_t dense);
+
+    std::vector<T> m_values;
+    std::vector<std::uint32_t> m_denseToSlot;  // Parallel to m_values
+    std::vector<Slot> m_slots;
+    std::vector<std::uint32_t> m_freeSlots;  // Used as a stack
+};
+
+template <typename T>
+SlotHandle SlotMap<T>::insert(T value) {
+    std::uint32_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    m_slots[slot].dense = static_cast<std::uint32_t>(m_values.size());
+    m_values.push_back(std::move(value));
+    m_denseToSlot.push_back(slot);
+
+    SlotHandle handle;
+    handle.index = slot;
+    handle.generation = m_slots[slot].generation;
+    return handle;
+}
+
+template <typename T>
+bool SlotMap<T>::erase(SlotHandle handle) {
+    if (!contains(handle)) return false;
+
+    eraseAt(m_slots[handle.index].dense);
+    return true;
+}
+
+template <typename T>
+template <typename Predicate>
+std::size_t SlotMap<T>::eraseIf(Predicate predicate) {
+    std::size_t removed = 0;
+    // Walk backwards so the swapped-in last element has already been visited
+    for (std::size_t i = m_values.size(); i-- > 0;) {
+        if (predicate(m_values[i])) {
+            eraseAt(i);
+            ++removed;
+        }
+    }
+    return removed;
+}
+
+template <typename T>
+T* SlotMap<T>::get(SlotHandle handle) {
+    if (!handle.isValid() || handle.index >= m_slots.size() ||
+        m_slots[handle.index].generation != handle.generation) {
+        return nullptr;
+    }
+    return &m_values[m_slots[handle.index].dense];
+}
+
+template <typename T>
+const T* SlotMap<T>::get(SlotHandle handle) const {
+    return const_cast<SlotMap*>(this)->get(handle);
+}
+
+template <typename T>
+SlotHandle SlotMap<T>::handleAt(std::size_t i) const {
+    SlotHandle handle;
+    handle.index = m_denseToSlot[i];
+    handle.generation = m_slots[handle.index].generation;
+    return handle;
+}
+
+template <typename T>
+void SlotMap<T>::clear() {
+    for (std::uint32_t slot : m_denseToSlot) {
+        ++m_slots[slot].generation;
+        m_freeSlots.push_back(slot);
+    }
+    m_values.clear();
+    m_denseToSlot.clear();
+}
+
+template <typename T>
+void SlotMap<T>::reserve(std::size_t capacity) {
+    m_values.reserve(capacity);
+    m_denseToSlot.reserve(capacity);
+    m_slots.reserve(capacity);
+}
+
+template <typename T>
+void SlotMap<T>::eraseAt(std::size_t dense) {
+    const std::uint32_t slot = m_denseToSlot[dense];
+
+    // Move the last value into the hole
+    const std::size_t last = m_values.size() - 1;
+    if (dense != last) {
+        m_values[dense] = std::move(m_values[last]);
+        m_denseToSlot[dense] = m_denseToSlot[last];
+        m_slots[m_denseToSlot[dense]].dense = static_cast<std::uint32_t>(dense);
+    }
+    m_values.pop_back();
+    m_denseToSlot.pop_back();
+
+    ++m_slots[slot].generation;  // Invalidate outstanding handles
+    m_freeSlots.push_back(slot);
+}
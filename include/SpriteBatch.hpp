@@ -0,0 +1,87 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Draw order groups for batched world drawing, back to front
+ *
+ * Order between layers is always kept. Inside a layer the batch is free to
+ * regroup geometry by texture, so anything that must cover something else
+ * belongs in a later layer (or gets a higher depth).
+ */
+enum class RenderLayer : std::uint8_t {
+    Level,        // Ground and platforms
+    Projectiles,  // Enemy shots sit behind the entities that fire them
+    Entities,     // Entity sprites and fallback shapes
+    HealthBars,   // Bars above enemies and the boss
+    Effects       // Player glow, afterimages, attack hitboxes, parry shield
+};
+
+/**
+ * @brief Render queue that turns many small draws into a few vertex array draws
+ *
+ * Entities submit sprites and shapes with a (layer, texture, depth) sort key
+ * instead of drawing them. flush() sorts the queue by that key and draws each
+ * run of geometry sharing a texture with a single call, so the whole world is
+ * a handful of draws per frame once every sprite lives in one atlas page.
+ *
+ * Equal keys keep their submission order, so a health bar background
+ * submitted before its bar still ends up underneath it.
+ *
+ * Usage: batch.submit(sprite, RenderLayer::Entities); ... batch.flush(window);
+ */
+class SpriteBatch {
+public:
+    SpriteBatch();
+
+    /**
+     * @brief Queue a textured sprite (transform, texture rect and color are read from it)
+     * @param depth Order inside the layer's texture group, lower draws first
+     */
+    void submit(const sf::Sprite& sprite, RenderLayer layer, float depth = 0.f);
+
+    /**
+     * @brief Queue a convex shape's fill and outline, like window.draw(shape) would
+     */
+    void submit(const sf::Shape& shape, RenderLayer layer, float depth = 0.f);
+
+    /**
+     * @brief Queue an axis-aligned solid rectangle
+     */
+    void submit(const sf::FloatRect& rect, const sf::Color& color, RenderLayer layer, float depth = 0.f);
+
+    /**
+     * @brief Queue raw triangles (vertex count must be a multiple of 3)
+     * @param texture Texture the texCoords refer to, or null for flat color
+     */
+    void submit(const sf::Vertex* vertices, std::size_t count, const sf::Texture* texture,
+                RenderLayer layer, float depth = 0.f);
+
+    /**
+     * @brief Draw everything queued since the last flush and empty the queue
+     */
+    void flush(sf::RenderTarget& target);
+
+    // Draw calls issued by the last flush (for profiling)
+    std::size_t getLastDrawCallCount() const { return m_lastDrawCalls; }
+
+private:
+    // One submission: a sort key and its slice of the staging buffer
+    struct Command {
+        std::uint64_t key;
+        std::uint32_t firstVertex;
+        std::uint32_t vertexCount;
+    };
+
+    std::uint64_t makeKey(RenderLayer layer, const sf::Texture* texture, float depth);
+    sf::Vertex* allocate(std::size_t count, const sf::Texture* texture, RenderLayer layer, float depth);
+
+    std::vector<sf::Vertex> m_staging;  // Vertices in submission order
+    std::vector<Command> m_commands;
+    std::vector<const sf::Texture*> m_textures;  // Texture id -> texture for this frame (id 0 = untextured)
+    sf::VertexArray m_vertices;  // Sorted vertices of the current draw
+    std::size_t m_lastDrawCalls;
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+/**
+ * @brief On-disk cache of generated sprite sheet images
+ *
+ * Each sheet is one file: a small header (magic, format version, content
+ * key, size, pixel checksum) followed by the raw RGBA8 pixels. The key is a
+ * hash of everything the image depends on (generator version, sheet kind),
+ * so changing the art invalidates old files. Any mismatch or damaged file is
+ * treated as a miss and the caller regenerates.
+ *
+ * Stateless apart from the directory, so load/store are safe from worker threads
+ * as long as two threads never use the same name at once.
+ */
+class SpriteSheetCache {
+public:
+    explicit SpriteSheetCache(std::filesystem::path directory);
+
+    /**
+     * @brief Read a cached image
+     * @param name File name inside the cache directory (without extension)
+     * @param key Content key the file must have been stored with
+     * @return The image, or nothing on a miss
+     */
+    std::optional<sf::Image> load(const std::string& name, std::uint64_t key) const;
+
+    /**
+     * @brief Write an image, replacing any older file with the same name
+     * @return False if the file couldn't be written (the cache is best effort)
+     */
+    bool store(const std::string& name, std::uint64_t key, const sf::Image& image) const;
+
+    /**
+     * @brief 64-bit FNV-1a hash, chainable through the seed
+     */
+    static std::uint64_t hash(const void* data, std::size_t size, std::uint64_t seed = FNV_OFFSET_BASIS);
+
+    static constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+
+private:
+    std::filesystem::path getPath(const std::string& name) const;
+
+    std::filesystem::path m_directory;
+
+    static constexpr std::uint32_t MAGIC = 0x43535A4B;  // "KZSC"
+    static constexpr std::uint32_t FORMAT_VERSION = 1;  // Bump when the file layout changes
+    static constexpr std::size_t HEADER_SIZE = 32;
+    static constexpr std::uint32_t MAX_DIMENSION = 8192;
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Where one sprite sheet lives inside an atlas page
+ *
+ * Holds a reference to its page, so a region keeps the texture alive for as
+ * long as the sprite using it.
+ */
+struct AtlasRegion {
+    std::shared_ptr<const sf::Texture> texture;  // Atlas page (null when headless)
+    sf::IntRect bounds;  // The sheet's area on the page
+    sf::Vector2i frameSize;  // Size of one animation frame in the sheet's grid
+
+    /**
+     * @brief Page rectangle of one frame in the sheet's frame grid
+     */
+    sf::IntRect getFrame(int column, int row) const {
+        return sf::IntRect(bounds.position + sf::Vector2i(column * frameSize.x, row * frameSize.y), frameSize);
+    }
+};
+
+/**
+ * @brief Packs sprite sheet images into a few large texture pages
+ *
+ * Sprites whose sheets share a page can be drawn with one texture bound,
+ * which is what makes batched sprite drawing possible. Add images (any
+ * thread may have produced them), then build() once on the main thread to
+ * pack them with a shelf packer and upload the pages.
+ *
+ * Usage: atlas.add("enemy", image, {80, 64}); atlas.build();
+ *        AtlasRegion enemy = atlas.getRegion("enemy");
+ */
+class TextureAtlas {
+public:
+    explicit TextureAtlas(unsigned int pageSize = DEFAULT_PAGE_SIZE);
+
+    /**
+     * @brief Queue an image for the next build()
+     * @param frameSize Animation frame size within the image
+     */
+    void add(const std::string& name, const sf::Image& image, const sf::Vector2i& frameSize);
+
+    /**
+     * @brief Pack every queued image into pages and upload them (main thread only)
+     * @return False if a page failed to upload
+     */
+    bool build();
+
+    /**
+     * @brief Region for a packed image, or an empty region if the name is unknown
+     */
+    AtlasRegion getRegion(const std::string& name) const;
+    bool hasRegion(const std::string& name) const;
+
+    std::size_t getPageCount() const { return m_pages.size(); }
+
+    static constexpr unsigned int DEFAULT_PAGE_SIZE = 2048;
+
+private:
+    struct PendingImage {
+        std::string name;
+        sf::Image image;
+        sf::Vector2i frameSize;
+    };
+
+    std::vector<PendingImage> m_pending;
+    std::vector<std::shared_ptr<sf::Texture>> m_pages;
+    std::unordered_map<std::string, AtlasRegion> m_regions;
+    unsigned int m_pageSize;
+
+    static constexpr int PADDING = 2;  // Transparent gap between sheets
+};
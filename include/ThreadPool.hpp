@@ -0,0 +1,95 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Fixed set of work-stealing worker threads for background and data-parallel work
+ *
+ * Every worker has its own task deque. Tasks queued from outside the pool
+ * are dealt to the workers round-robin; tasks queued by a task go on its own
+ * worker's deque, which that worker takes newest first. A worker whose deque
+ * is empty steals the oldest task from another worker before going to sleep.
+ *
+ * Tasks must not touch SFML graphics objects (textures, windows): those
+ * stay on the main thread, so workers only produce CPU-side data such as
+ * images or simulation state.
+ *
+ * Usage: auto image = ThreadPool::getInstance().submit([] { return build(); });
+ *        ThreadPool::getInstance().parallelFor(rows, [&](std::size_t row) { ... });
+ *        ThreadPool::getInstance().parallelFor(count, 16, [&](std::size_t begin, std::size_t end) { ... });
+ */
+class ThreadPool {
+public:
+    // Shared pool sized to the machine (one core left for the main thread)
+    static ThreadPool& getInstance();
+
+    explicit ThreadPool(unsigned int threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queue a task
+     * @return Future for the task's result (rethrows the task's exception on get())
+     */
+    template <typename Task>
+    std::future<std::invoke_result_t<Task>> submit(Task&& task);
+
+    /**
+     * @brief Run body(0) .. body(count - 1) across the pool and wait for all of them
+     *
+     * The calling thread works through indices too, so this is safe to call
+     * from inside a pool task and never waits on a queue it is blocking.
+     */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& body);
+
+    /**
+     * @brief Run body(begin, end) over [0, count) in chunks of chunkSize indices and wait
+     *
+     * Chunk boundaries depend only on count and chunkSize, never on which
+     * thread runs them, so per-chunk results can be merged deterministically.
+     * A single chunk runs inline on the caller.
+     */
+    void parallelFor(std::size_t count, std::size_t chunkSize,
+                     const std::function<void(std::size_t, std::size_t)>& body);
+
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(m_workers.size()); }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void enqueue(std::function<void()> task);
+    bool takeTask(std::size_t worker, std::function<void()>& task);
+    void workerLoop(std::size_t worker);
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;  // One per worker
+    std::atomic<std::size_t> m_queuedTasks;  // Across all queues
+    std::atomic<std::size_t> m_nextQueue;  // Round-robin target for outside submissions
+    std::mutex m_mutex;  // Guards sleeping and m_stopping
+    std::condition_variable m_taskAvailable;
+    bool m_stopping;
+};
+
+template <typename Task>
+std::future<std::invoke_result_t<Task>> ThreadPool::submit(Task&& task) {
+    using Result = std::invoke_result_t<Task>;
+    // std::function needs a copyable target, packaged_task is move-only
+    auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+    std::future<Result> result = packaged->get_future();
+    enqueue([packaged]() { (*packaged)(); });
+    return result;
+}
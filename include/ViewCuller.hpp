@@ -0,0 +1,55 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+/**
+ * @brief Objects drawn and skipped by the last culling pass
+ */
+struct CullStats {
+    std::size_t drawn = 0;
+    std::size_t culled = 0;
+};
+
+/**
+ * @brief Per-frame visibility test against the camera's view rectangle
+ *
+ * The game sets the visible rectangle once per frame; renderers then ask
+ * isVisible() for each object's bounds before building any geometry for it,
+ * so render cost follows what is on screen rather than the size of the level.
+ * The rectangle is grown by a margin that covers sprite overhang (sprites
+ * are drawn larger than their collision bounds) and particle trails.
+ *
+ * Usage: culler.begin(camera.getVisibleRect(alpha));
+ *        if (culler.isVisible(enemy.getBounds())) enemy.render(batch);
+ */
+class ViewCuller {
+public:
+    explicit ViewCuller(float margin = DEFAULT_MARGIN);
+
+    /**
+     * @brief Start a frame: set the view rectangle and reset the counters
+     */
+    void begin(const sf::FloatRect& visibleRect);
+
+    /**
+     * @brief Whether bounds overlap the (margin-grown) view; counts the result
+     */
+    bool isVisible(const sf::FloatRect& bounds);
+
+    /**
+     * @brief Point test for small objects such as particles
+     * @param radius How far the object reaches from the point
+     */
+    bool isVisible(const sf::Vector2f& point, float radius);
+
+    const sf::FloatRect& getCullRect() const { return m_cullRect; }
+    const CullStats& getStats() const { return m_stats; }
+
+    static constexpr float DEFAULT_MARGIN = 128.f;  // Largest sprite overhang past an entity's bounds
+
+private:
+    sf::FloatRect m_cullRect;
+    float m_margin;
+    CullStats m_stats;
+};
@@ -0,0 +1,154 @@
+#include "AIScheduler.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    float microsecondsSince(Clock::time_point start) {
+        return std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+    }
+}
+
+AIScheduler::AIScheduler()
+    : m_budgetMicroseconds(DEFAULT_BUDGET_MICROSECONDS)
+{
+}
+
+void AIScheduler::update(SlotMap<std::unique_ptr<Enemy>>& enemies, Boss* boss, const sf::Vector2f& targetPosition,
+                         const sf::FloatRect& viewRect, float deltaTime) {
+    const Clock::time_point start = Clock::now();
+    m_stats = AIScheduleStats();
+    m_due.clear();
+    m_jobs.clear();
+
+    for (std::size_t i = 0; i < enemies.size(); ++i) {
+        Enemy* enemy = enemies[i].get();
+        if (!enemy || !enemy->isActive()) continue;
+
+        Entry& entry = entryFor(enemies.handleAt(i));
+        entry.pendingTime = std::min(entry.pendingTime + deltaTime, MAX_ACCUMULATED_TIME);
+        ++entry.ticksWaited;
+
+        const Tier tier = classify(enemy->getBounds(), targetPosition, viewRect);
+        enemy->setDormant(tier == Tier::Dormant);
+        switch (tier) {
+            case Tier::Full:
+                scheduleEnemy(*enemy, entry, targetPosition);
+                ++m_stats.full;
+                break;
+            case Tier::Reduced:
+                if (entry.ticksWaited >= REDUCED_INTERVAL) {
+                    m_due.push_back(i);
+                }
+                break;
+            case Tier::Dormant:
+                // Frozen: no time passes for the AI while nobody is near, and the body stops
+                entry.ticksWaited = 0;
+                entry.pendingTime = 0.f;
+                ++m_stats.dormant;
+                break;
+        }
+    }
+
+    if (boss && boss->isActive()) {
+        boss->setTarget(targetPosition);
+        m_jobs.push_back(Job{boss, deltaTime});
+    }
+
+    // Every job gets a buffer up front so the ones handed out stay put
+    if (m_intents.size() < m_jobs.size() + m_due.size()) {
+        m_intents.resize(m_jobs.size() + m_due.size());
+    }
+
+    // Full tier and boss are never deferred, and don't eat into the reduced-tier budget
+    runJobs(0, m_jobs.size());
+    const Clock::time_point reducedStart = Clock::now();
+
+    // Most overdue first, so enemies deferred last tick aren't starved
+    std::stable_sort(m_due.begin(), m_due.end(), [&](std::size_t a, std::size_t b) {
+        return m_entries[enemies.handleAt(a).index].ticksWaited > m_entries[enemies.handleAt(b).index].ticksWaited;
+    });
+
+    // Reduced tier in batches, checking the budget between them
+    std::size_t next = 0;
+    while (next < m_due.size()) {
+        if (m_budgetMicroseconds > 0.f && microsecondsSince(reducedStart) >= m_budgetMicroseconds) {
+            m_stats.deferred = m_due.size() - next;
+            break;
+        }
+
+        const std::size_t batchEnd = std::min(next + REDUCED_BATCH, m_due.size());
+        const std::size_t firstJob = m_jobs.size();
+        for (; next < batchEnd; ++next) {
+            const std::size_t i = m_due[next];
+            scheduleEnemy(*enemies[i], m_entries[enemies.handleAt(i).index], targetPosition);
+            ++m_stats.reduced;
+        }
+        runJobs(firstJob, m_jobs.size());
+    }
+
+    // Merge on this thread, in schedule order
+    for (std::size_t i = 0; i < m_jobs.size(); ++i) {
+        m_jobs[i].entity->setIntentBuffer(nullptr);
+        m_intents[i].commit();
+    }
+
+    m_stats.microseconds = microsecondsSince(start);
+}
+
+AIScheduler::Tier AIScheduler::classify(const sf::FloatRect& enemyBounds, const sf::Vector2f& targetPosition,
+                                        const sf::FloatRect& viewRect) {
+    if (enemyBounds.findIntersection(viewRect).has_value()) {
+        return Tier::Full;
+    }
+
+    const sf::Vector2f center = enemyBounds.position + enemyBounds.size / 2.f;
+    const float dx = center.x - targetPosition.x;
+    const float dy = center.y - targetPosition.y;
+    const float distanceSquared = dx * dx + dy * dy;
+    if (distanceSquared <= FULL_RADIUS * FULL_RADIUS) {
+        return Tier::Full;
+    }
+    if (distanceSquared <= DORMANT_RADIUS * DORMANT_RADIUS) {
+        return Tier::Reduced;
+    }
+    return Tier::Dormant;
+}
+
+AIScheduler::Entry& AIScheduler::entryFor(SlotHandle handle) {
+    if (handle.index >= m_entries.size()) {
+        m_entries.resize(handle.index + 1);
+    }
+
+    Entry& entry = m_entries[handle.index];
+    if (!entry.tracked || entry.generation != handle.generation) {
+        // New enemy in this slot: stagger its reduced-tier phase by slot
+        entry = Entry();
+        entry.generation = handle.generation;
+        entry.tracked = true;
+        entry.ticksWaited = handle.index % REDUCED_INTERVAL;
+    }
+    return entry;
+}
+
+void AIScheduler::scheduleEnemy(Enemy& enemy, Entry& entry, const sf::Vector2f& targetPosition) {
+    enemy.setTarget(targetPosition);
+    m_jobs.push_back(Job{&enemy, entry.pendingTime});
+    entry.pendingTime = 0.f;
+    entry.ticksWaited = 0;
+}
+
+void AIScheduler::runJobs(std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        m_jobs[i].entity->setIntentBuffer(&m_intents[i]);
+    }
+
+    // Each update only touches its own entity and buffer
+    ThreadPool::getInstance().parallelFor(end - begin, PARALLEL_GRAIN, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = begin + first; i < begin + last; ++i) {
+            m_jobs[i].entity->update(m_jobs[i].step);
+        }
+    });
+}
@@ -1,4 +1,15 @@
 #include "Attack.hpp"
+#include "SpriteBatch.hpp"
+
+Attack::Attack()
+    : m_type(Type::Light)
+    , m_hitbox()
+    , m_damage(0)
+    , m_lifetime(0.0f)
+    , m_duration(0.0f)
+    , m_isActive(false)
+{
+}
 
 Attack::Attack(Type type, const sf::Vector2f& position, bool facingRight, float damageMultiplier)
     : m_type(type)
@@ -63,13 +74,6 @@ Attack::Attack(Type type, const sf::Vector2f& position, bool facingRight, float
             sf::Vector2f(width, height)
         );
     }
-    
-    // Setup visual hitbox for feedback
-    m_visualHitbox.setPosition(m_hitbox.position);
-    m_visualHitbox.setSize(m_hitbox.size);
-    m_visualHitbox.setFillColor(sf::Color(255, 100, 100, 100)); // Semi-transparent red
-    m_visualHitbox.setOutlineColor(sf::Color::Red);
-    m_visualHitbox.setOutlineThickness(2.0f);
 }
 
 void Attack::update(float deltaTime) {
@@ -79,16 +83,20 @@ void Attack::update(float deltaTime) {
     if (m_lifetime >= m_duration) {
         m_isActive = false;
     }
-    
-    // Fade out effect
-    if (m_isActive) {
-        float alpha = 1.0f - (m_lifetime / m_duration);
-        m_visualHitbox.setFillColor(sf::Color(255, 100, 100, static_cast<uint8_t>(alpha * 100)));
-    }
 }
 
-void Attack::render(sf::RenderWindow& window) {
-    if (m_isActive) {
-        window.draw(m_visualHitbox);
-    }
+void Attack::render(SpriteBatch& batch) const {
+    if (!m_isActive) return;
+    
+    // Semi-transparent red fill that fades out, with a 2px red outline around it
+    float alpha = 1.0f - (m_lifetime / m_duration);
+    batch.submit(m_hitbox, sf::Color(255, 100, 100, static_cast<uint8_t>(alpha * 100)), RenderLayer::Effects);
+    
+    const float t = 2.0f;
+    const sf::Vector2f& p = m_hitbox.position;
+    const sf::Vector2f& s = m_hitbox.size;
+    batch.submit(sf::FloatRect({p.x - t, p.y - t}, {s.x + 2.f * t, t}), sf::Color::Red, RenderLayer::Effects);
+    batch.submit(sf::FloatRect({p.x - t, p.y + s.y}, {s.x + 2.f * t, t}), sf::Color::Red, RenderLayer::Effects);
+    batch.submit(sf::FloatRect({p.x - t, p.y}, {t, s.y}), sf::Color::Red, RenderLayer::Effects);
+    batch.submit(sf::FloatRect({p.x + s.x, p.y}, {t, s.y}), sf::Color::Red, RenderLayer::Effects);
 }
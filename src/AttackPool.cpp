@@ -0,0 +1,90 @@
+#include "AttackPool.hpp"
+#include "SpriteBatch.hpp"
+
+AttackPool::AttackPool()
+    : m_generations()
+    , m_denseIndex()
+    , m_active()
+    , m_free()
+    , m_activeCount(0)
+    , m_freeCount(0)
+    , m_showHitboxes(true)
+{
+    clear();
+}
+
+AttackHandle AttackPool::spawn(Attack::Type type, const sf::Vector2f& position, bool facingRight, float damageMultiplier) {
+    if (m_freeCount == 0) {
+        return AttackHandle();
+    }
+
+    const std::uint16_t slot = m_free[--m_freeCount];
+    m_attacks[slot] = Attack(type, position, facingRight, damageMultiplier);
+    m_denseIndex[slot] = static_cast<std::uint16_t>(m_activeCount);
+    m_active[m_activeCount++] = slot;
+
+    AttackHandle handle;
+    handle.index = slot;
+    handle.generation = m_generations[slot];
+    return handle;
+}
+
+Attack* AttackPool::get(AttackHandle handle) {
+    if (!handle.isValid() || handle.index >= CAPACITY || m_generations[handle.index] != handle.generation) {
+        return nullptr;
+    }
+    return &m_attacks[handle.index];
+}
+
+const Attack* AttackPool::get(AttackHandle handle) const {
+    return const_cast<AttackPool*>(this)->get(handle);
+}
+
+void AttackPool::release(AttackHandle handle) {
+    if (get(handle) != nullptr) {
+        releaseSlot(handle.index);
+    }
+}
+
+void AttackPool::releaseSlot(std::size_t slot) {
+    // Swap-remove from the dense list
+    const std::uint16_t position = m_denseIndex[slot];
+    const std::uint16_t last = m_active[--m_activeCount];
+    m_active[position] = last;
+    m_denseIndex[last] = position;
+
+    ++m_generations[slot];  // Invalidate outstanding handles
+    m_free[m_freeCount++] = static_cast<std::uint16_t>(slot);
+}
+
+void AttackPool::update(float deltaTime) {
+    // Walk backwards so swap-removal never skips an attack
+    for (std::size_t i = m_activeCount; i-- > 0;) {
+        const std::uint16_t slot = m_active[i];
+        m_attacks[slot].update(deltaTime);
+        if (!m_attacks[slot].isActive()) {
+            releaseSlot(slot);
+        }
+    }
+}
+
+void AttackPool::render(SpriteBatch& batch) const {
+    if (!m_showHitboxes) return;
+
+    for (std::size_t i = 0; i < m_activeCount; ++i) {
+        m_attacks[m_active[i]].render(batch);
+    }
+}
+
+void AttackPool::clear() {
+    for (std::size_t i = 0; i < m_activeCount; ++i) {
+        ++m_generations[m_active[i]];
+    }
+    m_activeCount = 0;
+
+    // Lowest slots first off the stack
+    m_freeCount = CAPACITY;
+    for (std::size_t i = 0; i < CAPACITY; ++i) {
+        m_free[i] = static_cast<std::uint16_t>(CAPACITY - 1 - i);
+    }
+}
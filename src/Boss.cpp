@@ -1,10 +1,11 @@
 #include "Boss.hpp"
 #include "Physics.hpp"
-#include "PixelArtGenerator.hpp"
+#include "ResourceManager.hpp"
+#include "SpriteBatch.hpp"
 #include <cmath>
 
-Boss::Boss(BossType type, const sf::Vector2f& startPosition)
-    : Entity()
+Boss::Boss(EntityStore& store, BossType type, const sf::Vector2f& startPosition)
+    : Entity(store)
     , m_bossType(type)
     , m_currentPhase(Phase::Phase1)
     , m_targetPosition(0.f, 0.f)
@@ -25,23 +26,25 @@ Boss::Boss(BossType type, const sf::Vector2f& startPosition)
         setMaxHealth(200);    // Much more health
         
         // Dark red appearance for executioner
-        m_shape.setSize(m_size);
+        m_shape.setSize(m_transform->size);
         m_shape.setFillColor(sf::Color(150, 20, 20));
         m_shape.setOutlineColor(sf::Color(100, 10, 10));
         m_shape.setOutlineThickness(3.f);
     }
     
     // Setup health bar
-    m_healthBarBackground.setSize(sf::Vector2f(m_size.x * 1.5f, 8.f));
+    m_healthBarBackground.setSize(sf::Vector2f(m_transform->size.x * 1.5f, 8.f));
     m_healthBarBackground.setFillColor(sf::Color(40, 40, 40));
     
-    m_healthBar.setSize(sf::Vector2f(m_size.x * 1.5f, 8.f));
+    m_healthBar.setSize(sf::Vector2f(m_transform->size.x * 1.5f, 8.f));
     m_healthBar.setFillColor(sf::Color(200, 50, 0));  // Orange for boss health
     
     // Create sprite and animations
     createSpriteSheet();
     setupAnimations();
-    m_sprite.emplace(m_texture);
+    if (m_sheet.texture) {
+        m_sprite.emplace(*m_sheet.texture);
+    }
     m_animController.setAnimation("idle");
 }
 
@@ -67,35 +70,28 @@ void Boss::update(float deltaTime) {
     }
     
     // Apply friction
-    m_velocity.x *= 0.92f;
-    
-    // Apply gravity
-    m_velocity = Physics::applyGravity(m_velocity, deltaTime);
+    m_body->velocity.x *= 0.92f;
     
-    // Ground collision (simplified)
-    if (m_position.y + m_size.y >= 600.f) {
-        m_position.y = 600.f - m_size.y;
-        m_velocity.y = 0.f;
-    }
+    // Apply gravity (platform contact is resolved by the world's collision pass)
+    m_body->velocity = Physics::applyGravity(m_body->velocity, deltaTime);
     
     // Update behavior
     updateBehavior(deltaTime);
     
     // Update animation and particles
     updateAnimation(deltaTime);
-    m_particles.update(deltaTime);
 }
 
 void Boss::updateBehavior(float deltaTime) {
     // Get distance to target
-    float distanceToTarget = std::abs(m_targetPosition.x - m_position.x);
+    float distanceToTarget = std::abs(m_targetPosition.x - m_transform->position.x);
     
     // If target in detection range
     if (distanceToTarget < DETECTION_RANGE) {
         // Move toward target if not in attack range
         if (distanceToTarget > ATTACK_RANGE) {
-            float direction = (m_targetPosition.x > m_position.x) ? 1.f : -1.f;
-            m_velocity.x = direction * m_moveSpeed * deltaTime * 60.f;
+            float direction = (m_targetPosition.x > m_transform->position.x) ? 1.f : -1.f;
+            m_body->velocity.x = direction * m_moveSpeed * deltaTime * 60.f;
             m_movingRight = (direction > 0);
         } else {
             // In attack range - try to attack
@@ -127,10 +123,10 @@ void Boss::performAttack() {
     }
     
     // Emit attack particles
-    float attackX = m_facingRight ? m_position.x + m_size.x : m_position.x;
+    float attackX = m_facingRight ? m_transform->position.x + m_transform->size.x : m_transform->position.x;
     sf::Vector2f direction(m_facingRight ? 1.f : -1.f, -0.2f);
     m_particles.emitDirectional(
-        sf::Vector2f(attackX, m_position.y + m_size.y / 2),
+        sf::Vector2f(attackX, m_transform->position.y + m_transform->size.y / 2),
         direction,
         8,
         sf::Color(220, 80, 120),
@@ -154,12 +150,13 @@ void Boss::checkPhaseTransition() {
     }
 }
 
-void Boss::render(sf::RenderWindow& window) const {
+void Boss::setIntentBuffer(IntentBuffer* intents) {
+    m_particles.setIntentBuffer(intents);
+}
+
+void Boss::render(SpriteBatch& batch) const {
     if (!isActive()) return;
     
-    // Render particles first (behind boss)
-    m_particles.render(window);
-    
     // Use sprite if available
     if (m_sprite.has_value()) {
         // Get current animation frame
@@ -168,8 +165,8 @@ void Boss::render(sf::RenderWindow& window) const {
         
         // Position sprite centered on entity position
         m_sprite->setPosition(sf::Vector2f(
-            m_position.x + m_size.x / 2.f,
-            m_position.y + m_size.y / 2.f
+            m_transform->position.x + m_transform->size.x / 2.f,
+            m_transform->position.y + m_transform->size.y / 2.f
         ));
         
         // Set origin to center for proper flipping
@@ -179,8 +176,8 @@ void Boss::render(sf::RenderWindow& window) const {
         ));
         
         // Scale to match entity size (increased by 1.5x)
-        float scaleX = m_size.x / frameRect.size.x * 1.5f;
-        float scaleY = m_size.y / frameRect.size.y * 1.5f;
+        float scaleX = m_transform->size.x / frameRect.size.x * 1.5f;
+        float scaleY = m_transform->size.y / frameRect.size.y * 1.5f;
         
         // Flip sprite based on facing direction
         if (!m_facingRight) {
@@ -190,39 +187,39 @@ void Boss::render(sf::RenderWindow& window) const {
         m_sprite->setScale(sf::Vector2f(scaleX, scaleY));
         
         // Flash when invulnerable
-        if (m_invulnerable) {
-            int blinkPhase = static_cast<int>(m_invulnerabilityTimer * 20) % 2;
+        if (m_vitals->invulnerable) {
+            int blinkPhase = static_cast<int>(m_vitals->invulnerabilityTimer * 20) % 2;
             if (blinkPhase == 0) {
-                window.draw(*m_sprite);
+                batch.submit(*m_sprite, RenderLayer::Entities);
             }
         } else {
-            window.draw(*m_sprite);
+            batch.submit(*m_sprite, RenderLayer::Entities);
         }
     } else {
         // Fallback to old rendering
-        m_shape.setPosition(sf::Vector2f(m_position.x, m_position.y));
+        m_shape.setPosition(sf::Vector2f(m_transform->position.x, m_transform->position.y));
         
-        if (m_invulnerable) {
-            int blinkPhase = static_cast<int>(m_invulnerabilityTimer * 20) % 2;
+        if (m_vitals->invulnerable) {
+            int blinkPhase = static_cast<int>(m_vitals->invulnerabilityTimer * 20) % 2;
             if (blinkPhase == 0) {
-                window.draw(m_shape);
+                batch.submit(m_shape, RenderLayer::Entities);
             }
         } else {
-            window.draw(m_shape);
+            batch.submit(m_shape, RenderLayer::Entities);
         }
     }
     
     // Draw health bar above boss
-    float healthBarWidth = m_size.x * 1.5f;
-    m_healthBarBackground.setPosition(sf::Vector2f(m_position.x - (healthBarWidth - m_size.x) / 2, 
-                                                     m_position.y - 15.f));
-    window.draw(m_healthBarBackground);
+    float healthBarWidth = m_transform->size.x * 1.5f;
+    m_healthBarBackground.setPosition(sf::Vector2f(m_transform->position.x - (healthBarWidth - m_transform->size.x) / 2, 
+                                                     m_transform->position.y - 15.f));
+    batch.submit(m_healthBarBackground, RenderLayer::HealthBars);
     
     float currentHealthWidth = healthBarWidth * getHealthPercentage();
     m_healthBar.setSize(sf::Vector2f(currentHealthWidth, 8.f));
-    m_healthBar.setPosition(sf::Vector2f(m_position.x - (healthBarWidth - m_size.x) / 2, 
-                                          m_position.y - 15.f));
-    window.draw(m_healthBar);
+    m_healthBar.setPosition(sf::Vector2f(m_transform->position.x - (healthBarWidth - m_transform->size.x) / 2, 
+                                          m_transform->position.y - 15.f));
+    batch.submit(m_healthBar, RenderLayer::HealthBars);
 }
 
 void Boss::setTarget(const sf::Vector2f& targetPos) {
@@ -237,10 +234,10 @@ sf::FloatRect Boss::getAttackHitbox() const {
     // Large attack hitbox based on attack pattern
     float attackWidth = 70.f + (m_attackPattern * 10.f);
     float attackHeight = 50.f;
-    float offsetX = m_movingRight ? m_size.x : -attackWidth;
+    float offsetX = m_movingRight ? m_transform->size.x : -attackWidth;
     
     return sf::FloatRect(
-        sf::Vector2f(m_position.x + offsetX, m_position.y + 15.f),
+        sf::Vector2f(m_transform->position.x + offsetX, m_transform->position.y + 15.f),
         sf::Vector2f(attackWidth, attackHeight)
     );
 }
@@ -251,12 +248,12 @@ void Boss::takeDamage(int damage) {
     
     // Add knockback when hit
     if (!isDead()) {
-        m_velocity.y = -150.f;
-        m_velocity.x = m_movingRight ? -100.f : 100.f;
+        m_body->velocity.y = -150.f;
+        m_body->velocity.x = m_movingRight ? -100.f : 100.f;
         
         // Emit hit particles
         m_particles.emitBurst(
-            sf::Vector2f(m_position.x + m_size.x / 2, m_position.y + m_size.y / 2),
+            sf::Vector2f(m_transform->position.x + m_transform->size.x / 2, m_transform->position.y + m_transform->size.y / 2),
             15,
             sf::Color(200, 100, 50),
             100.f,
@@ -268,21 +265,18 @@ void Boss::takeDamage(int damage) {
 }
 
 void Boss::createSpriteSheet() {
-    // Use the high-quality pixel art generator for detailed boss sprites
-    m_texture = PixelArtGenerator::createBossSpriteSheet();
-    m_texture.setSmooth(false);  // Pixel art style
+    // One generated sheet is shared by every boss
+    m_sheet = ResourceManager::getInstance().acquireSpriteSheet(SpriteSheetKind::Boss);
 }
 
 void Boss::setupAnimations() {
-    const int frameWidth = 80;
-    const int frameHeight = 64;
     const float frameDuration = 0.12f;
     
     // Idle animation (row 0)
     Animation idleAnim;
     idleAnim.setLooping(true);
     for (int i = 0; i < 8; ++i) {
-        idleAnim.addFrame(sf::IntRect(sf::Vector2i(i * frameWidth, 0), sf::Vector2i(frameWidth, frameHeight)), frameDuration);
+        idleAnim.addFrame(m_sheet.getFrame(i, 0), frameDuration);
     }
     m_animController.addAnimation("idle", idleAnim);
     
@@ -290,7 +284,7 @@ void Boss::setupAnimations() {
     Animation moveAnim;
     moveAnim.setLooping(true);
     for (int i = 0; i < 8; ++i) {
-        moveAnim.addFrame(sf::IntRect(sf::Vector2i(i * frameWidth, frameHeight), sf::Vector2i(frameWidth, frameHeight)), frameDuration * 0.9f);
+        moveAnim.addFrame(m_sheet.getFrame(i, 1), frameDuration * 0.9f);
     }
     m_animController.addAnimation("move", moveAnim);
     
@@ -298,7 +292,7 @@ void Boss::setupAnimations() {
     Animation attack1Anim;
     attack1Anim.setLooping(false);
     for (int i = 0; i < 8; ++i) {
-        attack1Anim.addFrame(sf::IntRect(sf::Vector2i(i * frameWidth, frameHeight * 2), sf::Vector2i(frameWidth, frameHeight)), frameDuration * 0.8f);
+        attack1Anim.addFrame(m_sheet.getFrame(i, 2), frameDuration * 0.8f);
     }
     m_animController.addAnimation("attack1", attack1Anim);
     
@@ -306,7 +300,7 @@ void Boss::setupAnimations() {
     Animation attack2Anim;
     attack2Anim.setLooping(false);
     for (int i = 0; i < 8; ++i) {
-        attack2Anim.addFrame(sf::IntRect(sf::Vector2i(i * frameWidth, frameHeight * 3), sf::Vector2i(frameWidth, frameHeight)), frameDuration * 0.8f);
+        attack2Anim.addFrame(m_sheet.getFrame(i, 3), frameDuration * 0.8f);
     }
     m_animController.addAnimation("attack2", attack2Anim);
     
@@ -314,7 +308,7 @@ void Boss::setupAnimations() {
     Animation phase2Anim;
     phase2Anim.setLooping(true);
     for (int i = 0; i < 8; ++i) {
-        phase2Anim.addFrame(sf::IntRect(sf::Vector2i(i * frameWidth, frameHeight * 4), sf::Vector2i(frameWidth, frameHeight)), frameDuration * 0.6f);
+        phase2Anim.addFrame(m_sheet.getFrame(i, 4), frameDuration * 0.6f);
     }
     m_animController.addAnimation("phase2", phase2Anim);
 }
@@ -323,12 +317,12 @@ void Boss::updateAnimation(float deltaTime) {
     // Determine animation state based on phase and state
     std::string targetAnim = "idle";
     
-    if (m_invulnerabilityTimer > 0) {
+    if (m_vitals->invulnerabilityTimer > 0) {
         targetAnim = "phase2";  // Flash during hit
     } else if (m_isAttacking) {
         // Alternate between attack animations
         targetAnim = (m_attackPattern % 2 == 0) ? "attack1" : "attack2";
-    } else if (std::abs(m_velocity.x) > 10.f) {
+    } else if (std::abs(m_body->velocity.x) > 10.f) {
         targetAnim = "move";
     } else {
         // Phase 2 changes idle animation
@@ -340,9 +334,9 @@ void Boss::updateAnimation(float deltaTime) {
     m_animController.update(deltaTime);
     
     // Update facing direction
-    if (m_velocity.x > 0.1f) {
+    if (m_body->velocity.x > 0.1f) {
         m_facingRight = true;
-    } else if (m_velocity.x < -0.1f) {
+    } else if (m_body->velocity.x < -0.1f) {
         m_facingRight = false;
     }
 }
@@ -5,6 +5,7 @@
 Camera::Camera(float windowWidth, float windowHeight)
     : m_view(sf::FloatRect({0.f, 0.f}, {windowWidth, windowHeight}))
     , m_position(windowWidth / 2.f, windowHeight / 2.f)
+    , m_previousCenter(m_position)
     , m_size(windowWidth, windowHeight)
     , m_minX(0.f)
     , m_maxX(windowWidth)
@@ -71,6 +72,17 @@ sf::View Camera::getView() const {
     return m_view;
 }
 
+sf::View Camera::getView(float alpha) const {
+    sf::View view = m_view;
+    view.setCenter(m_previousCenter + (m_view.getCenter() - m_previousCenter) * alpha);
+    return view;
+}
+
+sf::FloatRect Camera::getVisibleRect(float alpha) const {
+    const sf::View view = getView(alpha);
+    return sf::FloatRect(view.getCenter() - view.getSize() / 2.f, view.getSize());
+}
+
 void Camera::shake(float intensity, float duration) {
     m_isShaking = true;
     m_shakeIntensity = intensity;
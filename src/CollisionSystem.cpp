@@ -0,0 +1,145 @@
+#include "CollisionSystem.hpp"
+#include "Physics.hpp"
+#include <algorithm>
+
+void CollisionSystem::resolve(std::vector<CollisionBody>& bodies, const std::vector<Platform>& platforms,
+                              const PlatformGrid& grid, float deltaTime) {
+    for (auto& body : bodies) {
+        body.contacts = PlatformContacts();
+        body.cellKey = grid.cellKey(getSweptBounds(*body.entity));
+    }
+    
+    // Bodies in the same cells become neighbours; stable so ties keep submission order
+    std::stable_sort(bodies.begin(), bodies.end(),
+        [](const CollisionBody& a, const CollisionBody& b) { return a.cellKey < b.cellKey; });
+    
+    bool haveCandidates = false;
+    std::uint64_t candidateKey = 0;
+    for (auto& body : bodies) {
+        if (!haveCandidates || body.cellKey != candidateKey) {
+            grid.query(getSweptBounds(*body.entity), m_candidates);
+            candidateKey = body.cellKey;
+            haveCandidates = true;
+        }
+        resolveBody(body, platforms, deltaTime);
+    }
+}
+
+sf::FloatRect CollisionSystem::getSweptBounds(const Entity& entity) {
+    sf::FloatRect bounds = entity.getBounds();
+    sf::Vector2f previous = entity.getPreviousPosition();
+    sf::Vector2f min(std::min(bounds.position.x, previous.x), std::min(bounds.position.y, previous.y));
+    sf::Vector2f max(std::max(bounds.position.x, previous.x) + bounds.size.x,
+                     std::max(bounds.position.y, previous.y) + bounds.size.y);
+    return sf::FloatRect(min, max - min);
+}
+
+bool CollisionSystem::sweepMove(Entity& entity, const std::vector<Platform>& platforms,
+                                const std::vector<std::size_t>& candidates) {
+    sf::FloatRect bounds = entity.getBounds();
+    sf::Vector2f start = entity.getPreviousPosition();
+    sf::Vector2f displacement = bounds.position - start;
+    if (displacement.x == 0.f && displacement.y == 0.f) {
+        return false;
+    }
+    
+    // Stop the axis that hits first, then sweep what is left of the other axis from there.
+    // A body resting on a floor touches it at time 0, which only stops its fall; walls
+    // further along its run are still found by the second pass.
+    // The swept box is inset so bodies this sweep left CONTACT_SKIN deep last tick
+    // still count as touching, rather than as starting inside and being skipped.
+    const sf::Vector2f inset(SWEEP_INSET, SWEEP_INSET);
+    sf::FloatRect moving(start + inset, bounds.size - inset * 2.f);
+    sf::Vector2f remaining = displacement;
+    sf::Vector2f backOff;  // From the inset box's contact (SWEEP_INSET deep) to CONTACT_SKIN deep
+    bool shortened = false;
+    for (int pass = 0; pass < 2 && (remaining.x != 0.f || remaining.y != 0.f); ++pass) {
+        Physics::SweepHit first;
+        for (std::size_t index : candidates) {
+            Physics::SweepHit hit = Physics::sweepAABB(moving, remaining, platforms[index].getBounds());
+            if (!hit.hit || hit.time >= first.time) {
+                continue;
+            }
+            if (platforms[index].isOneWay() && hit.normal.y >= 0.f) {
+                continue;
+            }
+            first = hit;
+        }
+        
+        if (!first.hit) {
+            break;
+        }
+        
+        moving.position += remaining * first.time;
+        if (first.normal.x != 0.f) {
+            backOff.x = first.normal.x * (SWEEP_INSET - CONTACT_SKIN);
+            remaining = sf::Vector2f(0.f, remaining.y * (1.f - first.time));
+        } else {
+            backOff.y = first.normal.y * (SWEEP_INSET - CONTACT_SKIN);
+            remaining = sf::Vector2f(remaining.x * (1.f - first.time), 0.f);
+        }
+        shortened = true;
+    }
+    
+    if (!shortened) {
+        return false;
+    }
+    entity.setPosition(moving.position - inset + remaining + backOff);
+    return true;
+}
+
+void CollisionSystem::resolveBody(CollisionBody& body, const std::vector<Platform>& platforms, float deltaTime) const {
+    Entity& entity = *body.entity;
+    sweepMove(entity, platforms, m_candidates);
+    
+    for (std::size_t index : m_candidates) {
+        const Platform& platform = platforms[index];
+        sf::FloatRect bounds = entity.getBounds();
+        sf::FloatRect platformBounds = platform.getBounds();
+        if (!bounds.findIntersection(platformBounds).has_value()) {
+            continue;
+        }
+        
+        sf::Vector2f velocity = entity.getVelocity();
+        float bottom = bounds.position.y + bounds.size.y;
+        
+        // One-way: only land if the feet were above the top edge before this tick's move
+        if (platform.isOneWay()) {
+            float previousBottom = entity.getPreviousPosition().y + bounds.size.y;
+            if (velocity.y >= 0.f && previousBottom <= platformBounds.position.y + ONE_WAY_TOLERANCE) {
+                entity.setPosition(bounds.position.x, platformBounds.position.y - bounds.size.y);
+                entity.setVelocity(velocity.x, 0.f);
+                body.contacts.onGround = true;
+            }
+            continue;
+        }
+        
+        // Solid/moving: push out along the axis of least overlap
+        float overlapLeft = (bounds.position.x + bounds.size.x) - platformBounds.position.x;
+        float overlapRight = (platformBounds.position.x + platformBounds.size.x) - bounds.position.x;
+        float overlapTop = bottom - platformBounds.position.y;
+        float overlapBottom = (platformBounds.position.y + platformBounds.size.y) - bounds.position.y;
+        float minOverlap = std::min(std::min(overlapLeft, overlapRight), std::min(overlapTop, overlapBottom));
+        
+        if (minOverlap == overlapTop && velocity.y >= 0.f) {
+            float carryX = platform.isMoving() ? platform.getVelocity().x * deltaTime : 0.f;
+            entity.setPosition(bounds.position.x + carryX, platformBounds.position.y - bounds.size.y);
+            entity.setVelocity(velocity.x, 0.f);
+            body.contacts.onGround = true;
+        }
+        else if (minOverlap == overlapBottom && velocity.y < 0.f) {
+            entity.setPosition(bounds.position.x, platformBounds.position.y + platformBounds.size.y);
+            entity.setVelocity(velocity.x, 0.f);
+        }
+        else if (minOverlap == overlapLeft) {
+            entity.setPosition(platformBounds.position.x - bounds.size.x, bounds.position.y);
+            entity.setVelocity(0.f, velocity.y);
+            body.contacts.wallOnRight = true;
+        }
+        else if (minOverlap == overlapRight) {
+            entity.setPosition(platformBounds.position.x + platformBounds.size.x, bounds.position.y);
+            entity.setVelocity(0.f, velocity.y);
+            body.contacts.wallOnLeft = true;
+        }
+    }
+}
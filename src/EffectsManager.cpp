@@ -45,18 +45,22 @@ void EffectsManager::update(float deltaTime) {
     m_attackTrail.update(deltaTime);
 }
 
-void EffectsManager::render(sf::RenderWindow& window) const {
+void EffectsManager::render(sf::RenderWindow& window, ViewCuller& culler) const {
     // Render flashes
     for (const auto& flash : m_flashes) {
-        flash->render(window);
+        if (culler.isVisible(flash->getBounds())) {
+            flash->render(window);
+        }
     }
     
     // Render attack trails
-    m_attackTrail.render(window);
+    m_attackTrail.render(window, culler);
     
     // Render damage numbers
     for (const auto& num : m_damageNumbers) {
-        num->render(window);
+        if (culler.isVisible(num->getBounds())) {
+            num->render(window);
+        }
     }
 }
 
@@ -1,69 +1,26 @@
 #include "Enemy.hpp"
-#include "Physics.hpp"
-#include "PixelArtGenerator.hpp"
+#include "EntitySystems.hpp"
+#include "IntentBuffer.hpp"
+#include "ProjectileSystem.hpp"
+#include "ResourceManager.hpp"
+#include "SpriteBatch.hpp"
 #include <cmath>
 #include <algorithm>
 
-// ===== Projectile Implementation =====
-
-Projectile::Projectile(const sf::Vector2f& position, const sf::Vector2f& direction, float speed, int damage, const sf::Color& color)
-    : m_position(position)
-    , m_velocity(direction * speed)
-    , m_damage(damage)
-    , m_active(true)
-    , m_lifetime(3.0f)
-{
-    m_shape.setRadius(6.f);
-    m_shape.setFillColor(color);
-    m_shape.setOrigin(sf::Vector2f(6.f, 6.f));
-    m_shape.setOutlineThickness(2.f);
-    m_shape.setOutlineColor(sf::Color(255, 255, 255, 150));
-}
-
-void Projectile::update(float deltaTime) {
-    if (!m_active) return;
-    
-    m_position += m_velocity * deltaTime;
-    m_lifetime -= deltaTime;
-    
-    if (m_lifetime <= 0.f) {
-        m_active = false;
-    }
-    
-    // Emit trail particles
-    sf::Color trailColor(m_shape.getFillColor().r, m_shape.getFillColor().g, m_shape.getFillColor().b, 180);
-    m_trail.emitTrail(m_position, trailColor, 2, 3.f);
-    m_trail.update(deltaTime);
-}
-
-void Projectile::render(sf::RenderWindow& window) const {
-    if (!m_active) return;
-    
-    m_trail.render(window);
-    m_shape.setPosition(m_position);
-    window.draw(m_shape);
-}
-
-sf::FloatRect Projectile::getBounds() const {
-    return sf::FloatRect(sf::Vector2f(m_position.x - 6.f, m_position.y - 6.f), sf::Vector2f(12.f, 12.f));
-}
-
-// ===== Enemy Implementation =====
-
-Enemy::Enemy(const sf::Vector2f& startPosition, float patrolRange, EnemyType type)
-    : Entity()
+Enemy::Enemy(EntityStore& store, const sf::Vector2f& startPosition, float patrolRange, EnemyType type)
+    : Entity(store, componentMask<AIComponent>())
     , m_type(type)
     , m_aiState(AIState::Patrol)
     , m_patrolOrigin(startPosition)
     , m_patrolRange(patrolRange)
     , m_patrolDirection(1.f)
-    , m_targetPosition(0.f, 0.f)
+    , m_ai(store.get<AIComponent>(m_id))
     , m_hoverHeight(0.f)
     , m_swoopTimer(0.f)
     , m_isSwooping(false)
-    , m_isAttacking(false)
-    , m_attackTimer(0.f)
     , m_attackDamage(10)
+    , m_projectiles(nullptr)
+    , m_intents(nullptr)
     , m_canBeKnockedBack(true)
     , m_facingRight(true)
 {
@@ -72,21 +29,29 @@ Enemy::Enemy(const sf::Vector2f& startPosition, float patrolRange, EnemyType typ
     // Configure stats based on type
     configureByType();
     
+    // Friction and gravity are applied by the batched enemy body step
+    m_body->friction = 0.95f;
+    m_body->usesGravity = (m_type != EnemyType::Flying);  // Flying enemies don't obey gravity
+    m_ai->hovers = (m_type == EnemyType::Flying);
+    m_ai->hoverTargetY = m_patrolOrigin.y - m_hoverHeight;
+    
     // Setup visual appearance
-    m_shape.setSize(m_size);
+    m_shape.setSize(m_transform->size);
     m_shape.setOutlineThickness(2.f);
     
     // Setup health bar
-    m_healthBarBackground.setSize(sf::Vector2f(m_size.x, 5.f));
+    m_healthBarBackground.setSize(sf::Vector2f(m_transform->size.x, 5.f));
     m_healthBarBackground.setFillColor(sf::Color(60, 60, 60));
     
-    m_healthBar.setSize(sf::Vector2f(m_size.x, 5.f));
+    m_healthBar.setSize(sf::Vector2f(m_transform->size.x, 5.f));
     m_healthBar.setFillColor(sf::Color(255, 0, 0));
     
     // Create sprite and animations
     createSpriteSheet();
     setupAnimations();
-    m_sprite.emplace(m_texture);
+    if (m_sheet.texture) {
+        m_sprite.emplace(*m_sheet.texture);
+    }
     m_animController.setAnimation("patrol");
 }
 
@@ -161,46 +126,15 @@ void Enemy::configureByType() {
 }
 
 void Enemy::update(float deltaTime) {
-    // Call base update for invulnerability timer
-    Entity::update(deltaTime);
-    
     // Don't update if dead
     if (isDead()) {
         setActive(false);
         return;
     }
     
-    // Update attack timer
-    if (m_attackTimer > 0.f) {
-        m_attackTimer -= deltaTime;
-    }
-    
-    // Update projectiles
-    for (auto& projectile : m_projectiles) {
-        projectile->update(deltaTime);
-    }
-    // Remove inactive projectiles
-    m_projectiles.erase(
-        std::remove_if(m_projectiles.begin(), m_projectiles.end(),
-            [](const std::unique_ptr<Projectile>& p) { return !p->isActive(); }),
-        m_projectiles.end()
-    );
-    
-    // Apply friction to horizontal velocity
-    m_velocity.x *= 0.95f;
-    
-    // Flying enemies don't obey gravity
+    // Flying enemies hover instead of falling
     if (m_type == EnemyType::Flying) {
         updateFlying(deltaTime);
-    } else {
-        // Apply gravity for ground enemies
-        m_velocity = Physics::applyGravity(m_velocity, deltaTime);
-        
-        // Check if on ground (simplified - ground at y=600)
-        if (m_position.y + m_size.y >= 600.f) {
-            m_position.y = 600.f - m_size.y;
-            m_velocity.y = 0.f;
-        }
     }
     
     // Update AI
@@ -208,7 +142,22 @@ void Enemy::update(float deltaTime) {
     
     // Update animation and particles
     updateAnimation(deltaTime);
-    m_particles.update(deltaTime);
+}
+
+void Enemy::onPlatformContact(const PlatformContacts& contacts) {
+    // Turn around at walls instead of pushing into them until the patrol range runs out
+    if (m_aiState == AIState::Patrol) {
+        if (contacts.wallOnRight && m_patrolDirection > 0.f) {
+            m_patrolDirection = -1.f;
+        } else if (contacts.wallOnLeft && m_patrolDirection < 0.f) {
+            m_patrolDirection = 1.f;
+        }
+    }
+}
+
+void Enemy::setIntentBuffer(IntentBuffer* intents) {
+    m_intents = intents;
+    m_particles.setIntentBuffer(intents);
 }
 
 void Enemy::updateAI(float deltaTime) {
@@ -231,16 +180,16 @@ void Enemy::updateAI(float deltaTime) {
 void Enemy::updatePatrol(float deltaTime) {
     (void)deltaTime;
     // Move back and forth within patrol range
-    m_velocity.x = m_patrolDirection * m_patrolSpeed;
+    m_body->velocity.x = m_patrolDirection * m_patrolSpeed;
     
     // Check if reached patrol boundary
-    float distanceFromOrigin = m_position.x - m_patrolOrigin.x;
+    float distanceFromOrigin = m_transform->position.x - m_patrolOrigin.x;
     if (std::abs(distanceFromOrigin) >= m_patrolRange) {
         m_patrolDirection *= -1.f;  // Reverse direction
     }
     
     // Check if player is in detection range
-    float distanceToTarget = std::abs(m_targetPosition.x - m_position.x);
+    float distanceToTarget = std::abs(m_ai->targetPosition.x - m_transform->position.x);
     if (distanceToTarget < m_detectionRange) {
         m_aiState = AIState::Chase;
     }
@@ -248,7 +197,7 @@ void Enemy::updatePatrol(float deltaTime) {
 
 void Enemy::updateChase(float deltaTime) {
     (void)deltaTime;
-    float distanceToTarget = std::abs(m_targetPosition.x - m_position.x);
+    float distanceToTarget = std::abs(m_ai->targetPosition.x - m_transform->position.x);
     
     // Ranged enemies maintain distance
     if (m_type == EnemyType::Ranged && distanceToTarget < m_preferredDistance) {
@@ -257,14 +206,14 @@ void Enemy::updateChase(float deltaTime) {
     }
     
     // Move toward target
-    float direction = (m_targetPosition.x > m_position.x) ? 1.f : -1.f;
-    m_velocity.x = direction * m_chaseSpeed;
+    float direction = (m_ai->targetPosition.x > m_transform->position.x) ? 1.f : -1.f;
+    m_body->velocity.x = direction * m_chaseSpeed;
     
     // Check if in attack range
     if (distanceToTarget < m_attackRange) {
         m_aiState = AIState::Attack;
         if (m_type != EnemyType::Flying) {  // Flying enemies keep moving during attack
-            m_velocity.x = 0.f;
+            m_body->velocity.x = 0.f;
         }
     }
     // Return to patrol if target too far
@@ -277,23 +226,23 @@ void Enemy::updateAttack(float deltaTime) {
     (void)deltaTime;
     // Stop moving during attack (except flying)
     if (m_type != EnemyType::Flying) {
-        m_velocity.x = 0.f;
+        m_body->velocity.x = 0.f;
     }
     
     // Attack if cooldown ready
-    if (m_attackTimer <= 0.f) {
-        m_isAttacking = true;
-        m_attackTimer = m_attackCooldown;
+    if (m_ai->attackTimer <= 0.f) {
+        m_ai->attacking = true;
+        m_ai->attackTimer = m_attackCooldown;
         
         // Ranged enemies shoot projectiles
         if (m_type == EnemyType::Ranged) {
             shootProjectile();
         } else {
             // Melee attack particles
-            float attackX = m_facingRight ? m_position.x + m_size.x : m_position.x;
+            float attackX = m_facingRight ? m_transform->position.x + m_transform->size.x : m_transform->position.x;
             sf::Vector2f direction(m_facingRight ? 1.f : -1.f, 0.f);
             m_particles.emitDirectional(
-                sf::Vector2f(attackX, m_position.y + m_size.y / 2),
+                sf::Vector2f(attackX, m_transform->position.y + m_transform->size.y / 2),
                 direction,
                 m_type == EnemyType::Tank ? 8 : 5,
                 m_type == EnemyType::Tank ? sf::Color(220, 200, 50) : sf::Color(220, 100, 50),
@@ -304,24 +253,24 @@ void Enemy::updateAttack(float deltaTime) {
             );
         }
     } else {
-        m_isAttacking = false;
+        m_ai->attacking = false;
     }
     
     // Check if still in attack range
-    float distanceToTarget = std::abs(m_targetPosition.x - m_position.x);
+    float distanceToTarget = std::abs(m_ai->targetPosition.x - m_transform->position.x);
     if (distanceToTarget > m_attackRange) {
         m_aiState = AIState::Chase;
-        m_isAttacking = false;
+        m_ai->attacking = false;
     }
 }
 
 void Enemy::updateRetreat(float deltaTime) {
     (void)deltaTime;
     // Move away from target to maintain preferred distance
-    float direction = (m_targetPosition.x > m_position.x) ? -1.f : 1.f;
-    m_velocity.x = direction * m_chaseSpeed * 0.8f;
+    float direction = (m_ai->targetPosition.x > m_transform->position.x) ? -1.f : 1.f;
+    m_body->velocity.x = direction * m_chaseSpeed * 0.8f;
     
-    float distanceToTarget = std::abs(m_targetPosition.x - m_position.x);
+    float distanceToTarget = std::abs(m_ai->targetPosition.x - m_transform->position.x);
     
     // If far enough, go back to attacking
     if (distanceToTarget >= m_preferredDistance) {
@@ -348,7 +297,7 @@ void Enemy::updateFlying(float deltaTime) {
     
     if (m_isSwooping) {
         // Swoop down toward player
-        targetY = m_targetPosition.y - 20.f;
+        targetY = m_ai->targetPosition.y - 20.f;
         m_swoopTimer += deltaTime;
         
         if (m_swoopTimer >= 0.8f) {  // Swoop duration
@@ -357,14 +306,14 @@ void Enemy::updateFlying(float deltaTime) {
         }
     }
     
-    // Smooth vertical movement
-    float yDiff = targetY - m_position.y;
-    m_velocity.y = yDiff * 3.f;  // Smooth hovering
+    // Smooth vertical movement (the body step keeps steering toward it on ticks the AI skips)
+    m_ai->hoverTargetY = targetY;
+    EntitySystems::steerHover(*m_transform, *m_body, *m_ai);
     
     // Emit trail particles while flying
-    if (std::abs(m_velocity.x) > 10.f || std::abs(m_velocity.y) > 10.f) {
+    if (std::abs(m_body->velocity.x) > 10.f || std::abs(m_body->velocity.y) > 10.f) {
         m_particles.emitTrail(
-            sf::Vector2f(m_position.x + m_size.x / 2, m_position.y + m_size.y),
+            sf::Vector2f(m_transform->position.x + m_transform->size.x / 2, m_transform->position.y + m_transform->size.y),
             sf::Color(180, 120, 220, 150),
             1,
             3.f
@@ -374,15 +323,20 @@ void Enemy::updateFlying(float deltaTime) {
 
 void Enemy::shootProjectile() {
     // Calculate direction to target
-    sf::Vector2f direction = m_targetPosition - sf::Vector2f(m_position.x + m_size.x / 2, m_position.y + m_size.y / 2);
+    sf::Vector2f direction = m_ai->targetPosition - sf::Vector2f(m_transform->position.x + m_transform->size.x / 2, m_transform->position.y + m_transform->size.y / 2);
     float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
     if (length > 0.f) {
         direction /= length;  // Normalize
     }
     
     // Create projectile
-    sf::Vector2f spawnPos(m_position.x + m_size.x / 2, m_position.y + m_size.y / 2);
-    m_projectiles.push_back(std::make_unique<Projectile>(spawnPos, direction, 300.f, m_attackDamage, sf::Color(100, 220, 100)));
+    sf::Vector2f spawnPos(m_transform->position.x + m_transform->size.x / 2, m_transform->position.y + m_transform->size.y / 2);
+    if (m_projectiles && m_intents) {
+        m_intents->recordProjectile(*m_projectiles, spawnPos, direction * 300.f, m_attackDamage,
+                                    sf::Color(100, 220, 100), this);
+    } else if (m_projectiles) {
+        m_projectiles->spawn(spawnPos, direction * 300.f, m_attackDamage, sf::Color(100, 220, 100), this);
+    }
     
     // Emit muzzle flash
     m_particles.emitBurst(
@@ -396,17 +350,9 @@ void Enemy::shootProjectile() {
     );
 }
 
-void Enemy::render(sf::RenderWindow& window) const {
+void Enemy::render(SpriteBatch& batch) const {
     if (!isActive()) return;
     
-    // Render projectiles
-    for (const auto& projectile : m_projectiles) {
-        projectile->render(window);
-    }
-    
-    // Render particles first (behind enemy)
-    m_particles.render(window);
-    
     // Use sprite if available
     if (m_sprite.has_value()) {
         // Get current animation frame
@@ -415,8 +361,8 @@ void Enemy::render(sf::RenderWindow& window) const {
         
         // Position sprite centered on entity position
         m_sprite->setPosition(sf::Vector2f(
-            m_position.x + m_size.x / 2.f,
-            m_position.y + m_size.y / 2.f
+            m_transform->position.x + m_transform->size.x / 2.f,
+            m_transform->position.y + m_transform->size.y / 2.f
         ));
         
         // Set origin to center for proper flipping
@@ -426,8 +372,8 @@ void Enemy::render(sf::RenderWindow& window) const {
         ));
         
         // Scale to match entity size (increased by 1.5x)
-        float scaleX = m_size.x / frameRect.size.x * 1.5f;
-        float scaleY = m_size.y / frameRect.size.y * 1.5f;
+        float scaleX = m_transform->size.x / frameRect.size.x * 1.5f;
+        float scaleY = m_transform->size.y / frameRect.size.y * 1.5f;
         
         // Flip sprite based on facing direction
         if (!m_facingRight) {
@@ -437,54 +383,54 @@ void Enemy::render(sf::RenderWindow& window) const {
         m_sprite->setScale(sf::Vector2f(scaleX, scaleY));
         
         // Flash when invulnerable
-        if (m_invulnerable) {
-            int blinkPhase = static_cast<int>(m_invulnerabilityTimer * 20) % 2;
+        if (m_vitals->invulnerable) {
+            int blinkPhase = static_cast<int>(m_vitals->invulnerabilityTimer * 20) % 2;
             if (blinkPhase == 0) {
-                window.draw(*m_sprite);
+                batch.submit(*m_sprite, RenderLayer::Entities);
             }
         } else {
-            window.draw(*m_sprite);
+            batch.submit(*m_sprite, RenderLayer::Entities);
         }
     } else {
         // Fallback to old rendering
-        m_shape.setPosition(sf::Vector2f(m_position.x, m_position.y));
+        m_shape.setPosition(sf::Vector2f(m_transform->position.x, m_transform->position.y));
         
-        if (m_invulnerable) {
-            int blinkPhase = static_cast<int>(m_invulnerabilityTimer * 20) % 2;
+        if (m_vitals->invulnerable) {
+            int blinkPhase = static_cast<int>(m_vitals->invulnerabilityTimer * 20) % 2;
             if (blinkPhase == 0) {
-                window.draw(m_shape);
+                batch.submit(m_shape, RenderLayer::Entities);
             }
         } else {
-            window.draw(m_shape);
+            batch.submit(m_shape, RenderLayer::Entities);
         }
     }
     
     // Draw health bar above enemy
-    m_healthBarBackground.setPosition(sf::Vector2f(m_position.x, m_position.y - 10.f));
-    window.draw(m_healthBarBackground);
+    m_healthBarBackground.setPosition(sf::Vector2f(m_transform->position.x, m_transform->position.y - 10.f));
+    batch.submit(m_healthBarBackground, RenderLayer::HealthBars);
     
-    float healthWidth = m_size.x * getHealthPercentage();
+    float healthWidth = m_transform->size.x * getHealthPercentage();
     m_healthBar.setSize(sf::Vector2f(healthWidth, 5.f));
-    m_healthBar.setPosition(sf::Vector2f(m_position.x, m_position.y - 10.f));
-    window.draw(m_healthBar);
+    m_healthBar.setPosition(sf::Vector2f(m_transform->position.x, m_transform->position.y - 10.f));
+    batch.submit(m_healthBar, RenderLayer::HealthBars);
 }
 
 void Enemy::setTarget(const sf::Vector2f& targetPos) {
-    m_targetPosition = targetPos;
+    m_ai->targetPosition = targetPos;
 }
 
 sf::FloatRect Enemy::getAttackHitbox() const {
-    if (!m_isAttacking) {
+    if (!m_ai->attacking) {
         return sf::FloatRect(sf::Vector2f(0, 0), sf::Vector2f(0, 0));  // No hitbox when not attacking
     }
     
     // Simple attack hitbox in front of enemy
     float attackWidth = 45.f;
     float attackHeight = 40.f;
-    float offsetX = (m_velocity.x >= 0) ? m_size.x : -attackWidth;
+    float offsetX = (m_body->velocity.x >= 0) ? m_transform->size.x : -attackWidth;
     
     return sf::FloatRect(
-        sf::Vector2f(m_position.x + offsetX, m_position.y + 10.f),
+        sf::Vector2f(m_transform->position.x + offsetX, m_transform->position.y + 10.f),
         sf::Vector2f(attackWidth, attackHeight)
     );
 }
@@ -495,15 +441,15 @@ void Enemy::takeDamage(int damage) {
     
     // Add knockback when hit (unless tank)
     if (!isDead() && m_canBeKnockedBack) {
-        m_velocity.y = -200.f;  // Small upward bounce
+        m_body->velocity.y = -200.f;  // Small upward bounce
         // Horizontal knockback away from attacker
-        m_velocity.x = m_patrolDirection * -150.f;
+        m_body->velocity.x = m_patrolDirection * -150.f;
     }
     
     // Emit hit particles (more for tanks)
     int particleCount = m_type == EnemyType::Tank ? 15 : 10;
     m_particles.emitBurst(
-        sf::Vector2f(m_position.x + m_size.x / 2, m_position.y + m_size.y / 2),
+        sf::Vector2f(m_transform->position.x + m_transform->size.x / 2, m_transform->position.y + m_transform->size.y / 2),
         particleCount,
         sf::Color::Red,
         0.3f,
@@ -514,25 +460,22 @@ void Enemy::takeDamage(int damage) {
 }
 
 void Enemy::createSpriteSheet() {
-    // Use the high-quality pixel art generator for detailed enemy sprites
-    m_texture = PixelArtGenerator::createEnemySpriteSheet();
-    m_texture.setSmooth(false);  // Pixel art style
+    // One generated sheet is shared by every enemy
+    m_sheet = ResourceManager::getInstance().acquireSpriteSheet(SpriteSheetKind::Enemy);
 }
 
 void Enemy::setupAnimations() {
-    // New sprite sheet layout: 640x320 with 80x64 frames
+    // Sprite sheet layout: 640x320 with 80x64 frames, placed in the sprite atlas
     // 5 rows (PATROL, CHASE, ATTACK, HIT, extra)
     // 8 frames per row
     
-    const int frameWidth = 80;
-    const int frameHeight = 64;
     const float frameDuration = 0.1f;
     
     // Patrol animation (row 0) - 8 frames
     Animation patrolAnim;
     patrolAnim.setLooping(true);
     for (int i = 0; i < 8; ++i) {
-        patrolAnim.addFrame(sf::IntRect(sf::Vector2i(i * frameWidth, 0 * frameHeight), sf::Vector2i(frameWidth, frameHeight)), frameDuration);
+        patrolAnim.addFrame(m_sheet.getFrame(i, 0), frameDuration);
     }
     m_animController.addAnimation("patrol", patrolAnim);
     
@@ -540,7 +483,7 @@ void Enemy::setupAnimations() {
     Animation chaseAnim;
     chaseAnim.setLooping(true);
     for (int i = 0; i < 8; ++i) {
-        chaseAnim.addFrame(sf::IntRect(sf::Vector2i(i * frameWidth, 1 * frameHeight), sf::Vector2i(frameWidth, frameHeight)), frameDuration * 0.8f);
+        chaseAnim.addFrame(m_sheet.getFrame(i, 1), frameDuration * 0.8f);
     }
     m_animController.addAnimation("chase", chaseAnim);
     
@@ -548,7 +491,7 @@ void Enemy::setupAnimations() {
     Animation attackAnim;
     attackAnim.setLooping(false);
     for (int i = 0; i < 6; ++i) {
-        attackAnim.addFrame(sf::IntRect(sf::Vector2i(i * frameWidth, 2 * frameHeight), sf::Vector2i(frameWidth, frameHeight)), frameDuration * 0.7f);
+        attackAnim.addFrame(m_sheet.getFrame(i, 2), frameDuration * 0.7f);
     }
     m_animController.addAnimation("attack", attackAnim);
     
@@ -556,7 +499,7 @@ void Enemy::setupAnimations() {
     Animation hitAnim;
     hitAnim.setLooping(false);
     for (int i = 0; i < 4; ++i) {
-        hitAnim.addFrame(sf::IntRect(sf::Vector2i(i * frameWidth, 3 * frameHeight), sf::Vector2i(frameWidth, frameHeight)), 0.05f);
+        hitAnim.addFrame(m_sheet.getFrame(i, 3), 0.05f);
     }
     m_animController.addAnimation("hit", hitAnim);
 }
@@ -565,7 +508,7 @@ void Enemy::updateAnimation(float deltaTime) {
     // Determine animation state based on AI state
     std::string targetAnim = "patrol";
     
-    if (m_invulnerabilityTimer > 0) {
+    if (m_vitals->invulnerabilityTimer > 0) {
         targetAnim = "hit";
     } else {
         switch (m_aiState) {
@@ -587,9 +530,9 @@ void Enemy::updateAnimation(float deltaTime) {
     m_animController.update(deltaTime);
     
     // Update facing direction
-    if (m_velocity.x > 0.1f) {
+    if (m_body->velocity.x > 0.1f) {
         m_facingRight = true;
-    } else if (m_velocity.x < -0.1f) {
+    } else if (m_body->velocity.x < -0.1f) {
         m_facingRight = false;
     }
 }
@@ -1,114 +1,126 @@
 #include "Entity.hpp"
-
-Entity::Entity()
-    : m_position(0.f, 0.f)
-    , m_velocity(0.f, 0.f)
-    , m_size(32.f, 32.f)  // Default size
-    , m_active(true)
-    , m_health(100)
-    , m_maxHealth(100)
-    , m_invulnerable(false)
-    , m_invulnerabilityTimer(0.0f)
+#include "EntitySystems.hpp"
+
+Entity::Entity(EntityStore& store, ComponentMask components)
+    : m_store(store)
+    , m_id(store.create(components | BASE_COMPONENTS))
+    , m_transform(store.get<TransformComponent>(m_id))
+    , m_body(store.get<PhysicsBodyComponent>(m_id))
+    , m_vitals(store.get<HealthComponent>(m_id))
 {
 }
 
+Entity::~Entity() {
+    m_store.destroy(m_id);
+}
+
 void Entity::update(float deltaTime) {
-    // Update invulnerability timer
-    if (m_invulnerable) {
-        m_invulnerabilityTimer -= deltaTime;
-        if (m_invulnerabilityTimer <= 0.0f) {
-            m_invulnerable = false;
-        }
-    }
-    
-    // Base update: apply velocity to position
-    m_position += m_velocity * deltaTime;
+    // Base update: invulnerability timer, then apply velocity to position
+    EntitySystems::stepBody(*m_transform, *m_body, *m_vitals, deltaTime);
 }
 
-void Entity::render(sf::RenderWindow& window) const {
+void Entity::render(SpriteBatch& batch) const {
     // Base class doesn't render anything
     // Derived classes override this
-    (void)window; // Suppress unused parameter warning
+    (void)batch; // Suppress unused parameter warning
+}
+
+void Entity::renderInterpolated(SpriteBatch& batch, float alpha) {
+    // Temporarily move to the blended position so derived render() code needs no changes
+    const sf::Vector2f simPosition = m_transform->position;
+    m_transform->position = m_transform->previousPosition + (simPosition - m_transform->previousPosition) * alpha;
+    render(batch);
+    m_transform->position = simPosition;
+}
+
+void Entity::onPlatformContact(const PlatformContacts& contacts) {
+    // Base class ignores contacts
+    (void)contacts;
+}
+
+void Entity::setIntentBuffer(IntentBuffer* intents) {
+    // Base class spawns nothing
+    (void)intents;
 }
 
 void Entity::setPosition(const sf::Vector2f& pos) {
-    m_position = pos;
+    m_transform->position = pos;
 }
 
 void Entity::setPosition(float x, float y) {
-    m_position = sf::Vector2f(x, y);
+    m_transform->position = sf::Vector2f(x, y);
 }
 
 sf::Vector2f Entity::getPosition() const {
-    return m_position;
+    return m_transform->position;
 }
 
 void Entity::setVelocity(const sf::Vector2f& vel) {
-    m_velocity = vel;
+    m_body->velocity = vel;
 }
 
 void Entity::setVelocity(float x, float y) {
-    m_velocity = sf::Vector2f(x, y);
+    m_body->velocity = sf::Vector2f(x, y);
 }
 
 sf::Vector2f Entity::getVelocity() const {
-    return m_velocity;
+    return m_body->velocity;
 }
 
 void Entity::setSize(const sf::Vector2f& size) {
-    m_size = size;
+    m_transform->size = size;
 }
 
 void Entity::setSize(float width, float height) {
-    m_size = sf::Vector2f(width, height);
+    m_transform->size = sf::Vector2f(width, height);
 }
 
 sf::Vector2f Entity::getSize() const {
-    return m_size;
+    return m_transform->size;
 }
 
 sf::FloatRect Entity::getBounds() const {
-    return sf::FloatRect(m_position, m_size);
+    return sf::FloatRect(m_transform->position, m_transform->size);
 }
 
 bool Entity::isActive() const {
-    return m_active;
+    return m_store.isEnabled(m_id);
 }
 
 void Entity::setActive(bool active) {
-    m_active = active;
+    m_store.setEnabled(m_id, active);
 }
 
 void Entity::takeDamage(int damage) {
-    if (m_invulnerable || m_health <= 0) {
+    if (m_vitals->invulnerable || m_vitals->health <= 0) {
         return;  // Already dead or invulnerable
     }
     
-    m_health -= damage;
-    if (m_health < 0) {
-        m_health = 0;
+    m_vitals->health -= damage;
+    if (m_vitals->health < 0) {
+        m_vitals->health = 0;
     }
     
     // Grant temporary invulnerability
-    m_invulnerable = true;
-    m_invulnerabilityTimer = INVULNERABILITY_DURATION;
+    m_vitals->invulnerable = true;
+    m_vitals->invulnerabilityTimer = INVULNERABILITY_DURATION;
     
     // Entity dies when health reaches 0
-    if (m_health <= 0) {
+    if (m_vitals->health <= 0) {
         // Death logic can be overridden by subclasses
     }
 }
 
 void Entity::heal(int amount) {
-    m_health += amount;
-    if (m_health > m_maxHealth) {
-        m_health = m_maxHealth;
+    m_vitals->health += amount;
+    if (m_vitals->health > m_vitals->maxHealth) {
+        m_vitals->health = m_vitals->maxHealth;
     }
 }
 
 void Entity::setMaxHealth(int maxHealth) {
-    m_maxHealth = maxHealth;
-    if (m_health > m_maxHealth) {
-        m_health = m_maxHealth;
+    m_vitals->maxHealth = maxHealth;
+    if (m_vitals->health > m_vitals->maxHealth) {
+        m_vitals->health = m_vitals->maxHealth;
     }
 }
@@ -0,0 +1,85 @@
+#include "EntityStore.hpp"
+
+EntityStore::Chunk::Chunk(ComponentMask components) {
+    allocate<TransformComponent>(components);
+    allocate<PhysicsBodyComponent>(components);
+    allocate<HealthComponent>(components);
+    allocate<AIComponent>(components);
+}
+
+EntityId EntityStore::create(ComponentMask components) {
+    std::size_t archetypeIndex = 0;
+    while (archetypeIndex < m_archetypes.size() && m_archetypes[archetypeIndex].components != components) {
+        ++archetypeIndex;
+    }
+    if (archetypeIndex == m_archetypes.size()) {
+        m_archetypes.emplace_back();
+        m_archetypes.back().components = components;
+    }
+    Archetype& archetype = m_archetypes[archetypeIndex];
+
+    // Reuse a freed row before growing the archetype
+    std::size_t chunkIndex;
+    std::size_t row;
+    if (!archetype.freeRows.empty()) {
+        chunkIndex = archetype.freeRows.back().first;
+        row = archetype.freeRows.back().second;
+        archetype.freeRows.pop_back();
+    } else {
+        if (archetype.chunks.empty() || archetype.chunks.back()->used == CHUNK_CAPACITY) {
+            archetype.chunks.push_back(std::make_unique<Chunk>(components));
+        }
+        chunkIndex = archetype.chunks.size() - 1;
+        row = archetype.chunks.back()->used++;
+    }
+
+    Chunk& chunk = *archetype.chunks[chunkIndex];
+    resetComponent<TransformComponent>(chunk, row);
+    resetComponent<PhysicsBodyComponent>(chunk, row);
+    resetComponent<HealthComponent>(chunk, row);
+    resetComponent<AIComponent>(chunk, row);
+    chunk.alive[row] = 1;
+    chunk.enabled[row] = 1;
+    ++m_entityCount;
+
+    EntityId id;
+    id.archetype = static_cast<std::uint16_t>(archetypeIndex);
+    id.chunk = static_cast<std::uint16_t>(chunkIndex);
+    id.row = static_cast<std::uint16_t>(row);
+    return id;
+}
+
+void EntityStore::destroy(EntityId id) {
+    Chunk* chunk = findChunk(id);
+    if (!chunk) return;
+
+    chunk->alive[id.row] = 0;
+    chunk->enabled[id.row] = 0;
+    m_archetypes[id.archetype].freeRows.emplace_back(id.chunk, id.row);
+    --m_entityCount;
+}
+
+bool EntityStore::isEnabled(EntityId id) const {
+    const Chunk* chunk = findChunk(id);
+    return chunk && chunk->enabled[id.row] != 0;
+}
+
+void EntityStore::setEnabled(EntityId id, bool enabled) {
+    if (Chunk* chunk = findChunk(id)) {
+        chunk->enabled[id.row] = enabled ? 1 : 0;
+    }
+}
+
+EntityStore::Chunk* EntityStore::findChunk(EntityId id) {
+    return const_cast<Chunk*>(static_cast<const EntityStore*>(this)->findChunk(id));
+}
+
+const EntityStore::Chunk* EntityStore::findChunk(EntityId id) const {
+    if (!id.isValid() || id.archetype >= m_archetypes.size() || id.row >= CHUNK_CAPACITY) return nullptr;
+
+    const Archetype& archetype = m_archetypes[id.archetype];
+    if (id.chunk >= archetype.chunks.size()) return nullptr;
+
+    const Chunk* chunk = archetype.chunks[id.chunk].get();
+    return chunk->alive[id.row] ? chunk : nullptr;
+}
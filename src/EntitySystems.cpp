@@ -0,0 +1,64 @@
+#include "EntitySystems.hpp"
+#include "Physics.hpp"
+
+namespace EntitySystems {
+
+namespace {
+    constexpr float HOVER_GAIN = 3.f;  // Vertical speed per pixel from the hover height
+}
+
+void stepBody(TransformComponent& transform, const PhysicsBodyComponent& body,
+              HealthComponent& health, float deltaTime) {
+    // Update invulnerability timer
+    if (health.invulnerable) {
+        health.invulnerabilityTimer -= deltaTime;
+        if (health.invulnerabilityTimer <= 0.0f) {
+            health.invulnerable = false;
+        }
+    }
+
+    // Apply velocity to position
+    transform.position += body.velocity * deltaTime;
+}
+
+void savePreviousState(EntityStore& store) {
+    store.forEach<TransformComponent>([](TransformComponent& transform) {
+        transform.previousPosition = transform.position;
+    });
+}
+
+void steerHover(const TransformComponent& transform, PhysicsBodyComponent& body, const AIComponent& ai) {
+    // Smooth hovering: speed proportional to the distance left
+    body.velocity.y = (ai.hoverTargetY - transform.position.y) * HOVER_GAIN;
+}
+
+void updateEnemyBodies(EntityStore& store, float deltaTime) {
+    store.forEach<TransformComponent, PhysicsBodyComponent, HealthComponent, AIComponent>(
+        [deltaTime](TransformComponent& transform, PhysicsBodyComponent& body,
+                    HealthComponent& health, AIComponent& ai) {
+            if (ai.dormant) {
+                // Nothing is steering, so keep the last AI-set speed from carrying it away
+                body.velocity.x = 0.f;
+                if (!body.usesGravity) {
+                    body.velocity.y = 0.f;
+                }
+            }
+
+            stepBody(transform, body, health, deltaTime);
+            if (health.health <= 0) return;
+
+            if (ai.attackTimer > 0.f) {
+                ai.attackTimer -= deltaTime;
+            }
+
+            body.velocity.x *= body.friction;
+            if (body.usesGravity) {
+                body.velocity = Physics::applyGravity(body.velocity, deltaTime);
+            }
+            if (ai.hovers && !ai.dormant) {
+                steerHover(transform, body, ai);
+            }
+        });
+}
+
+} // namespace EntitySystems
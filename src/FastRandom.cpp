@@ -0,0 +1,46 @@
+#include "FastRandom.hpp"
+#include <cmath>
+
+FastRandom::FastRandom(std::uint64_t seed) {
+    this->seed(seed);
+}
+
+void FastRandom::seed(std::uint64_t seed) {
+    // Expand the seed so nearby seeds give unrelated streams (and state is never all zero)
+    std::uint64_t state = seed;
+    const std::uint64_t a = splitMix64(state);
+    const std::uint64_t b = splitMix64(state);
+    m_state[0] = static_cast<std::uint32_t>(a);
+    m_state[1] = static_cast<std::uint32_t>(a >> 32);
+    m_state[2] = static_cast<std::uint32_t>(b);
+    m_state[3] = static_cast<std::uint32_t>(b >> 32);
+    if ((m_state[0] | m_state[1] | m_state[2] | m_state[3]) == 0) {
+        m_state[0] = 1;
+    }
+}
+
+void FastRandom::fill(float* out, std::size_t count, float min, float max) {
+    const float scale = (max - min) * (1.f / 16777216.f);
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = min + static_cast<float>(next() >> 8) * scale;
+    }
+}
+
+std::uint64_t FastRandom::splitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+const std::array<sf::Vector2f, FastRandom::DIRECTION_COUNT>& FastRandom::directionTable() {
+    static const std::array<sf::Vector2f, DIRECTION_COUNT> table = [] {
+        std::array<sf::Vector2f, DIRECTION_COUNT> directions;
+        for (std::size_t i = 0; i < DIRECTION_COUNT; ++i) {
+            double angle = static_cast<double>(i) * 6.283185307179586 / static_cast<double>(DIRECTION_COUNT);
+            directions[i] = sf::Vector2f(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+        }
+        return directions;
+    }();
+    return table;
+}
@@ -1,24 +1,24 @@
 #include "Game.hpp"
-#include "Physics.hpp"
-#include "Attack.hpp"
+#include "Input.hpp"
+#include "ParticleWorld.hpp"
 #include <iostream>
-#include <algorithm>
 
 Game::Game()
     : m_window(sf::VideoMode({WINDOW_WIDTH, WINDOW_HEIGHT}), "Nine Sols-like Game", sf::Style::Close)
-    , m_player(std::make_unique<Player>())
-    , m_camera(std::make_unique<Camera>(WINDOW_WIDTH, WINDOW_HEIGHT))
+    , m_fixedTimestep(true)
+    , m_tickDuration(1.f / DEFAULT_TICK_RATE)
+    , m_maxCatchUpSteps(DEFAULT_MAX_CATCH_UP_STEPS)
+    , m_accumulator(0.f)
+    , m_frameRateLimit(0)
+    , m_verticalSync(true)
     , m_hud(std::make_unique<HUD>(WINDOW_WIDTH, WINDOW_HEIGHT))
+    , m_drawCalls(0)
 {
     std::cout << "Creating window and player..." << std::endl;
-    m_window.setFramerateLimit(FPS_LIMIT);
-    m_window.setVerticalSyncEnabled(true);
+    m_window.setVerticalSyncEnabled(m_verticalSync);
     
     std::cout << "Initializing level..." << std::endl;
-    initializeLevel();
-    
-    // Set camera bounds to level size
-    m_camera->setLevelBounds(0.f, 0.f, 2560.f, 720.f);
+    m_world = std::make_unique<GameWorld>(static_cast<float>(WINDOW_WIDTH), static_cast<float>(WINDOW_HEIGHT));
     
     std::cout << "Game initialized successfully!" << std::endl;
 }
@@ -28,12 +28,66 @@ Game::~Game() {
 }
 
 void Game::run() {
+    // Level setup can take a while, don't count it as the first frame
+    m_clock.restart();
+    
     while (m_window.isOpen()) {
-        float deltaTime = m_clock.restart().asSeconds();
+        float frameTime = m_clock.restart().asSeconds();
         
         processEvents();
-        update(deltaTime);
-        render();
+        
+        if (!m_fixedTimestep) {
+            update(frameTime);
+            render();
+            continue;
+        }
+        
+        // Run whole ticks for the elapsed time, carry the remainder to the next frame
+        m_accumulator += frameTime;
+        int steps = 0;
+        while (m_accumulator >= m_tickDuration && steps < m_maxCatchUpSteps) {
+            update(m_tickDuration);
+            m_accumulator -= m_tickDuration;
+            ++steps;
+        }
+        
+        // Too far behind (long stall): drop the backlog instead of spiralling
+        if (m_accumulator >= m_tickDuration) {
+            m_accumulator = 0.f;
+        }
+        
+        render(m_accumulator / m_tickDuration);
+    }
+}
+
+void Game::setTickRate(unsigned int ticksPerSecond) {
+    if (ticksPerSecond > 0) {
+        m_tickDuration = 1.f / static_cast<float>(ticksPerSecond);
+    }
+}
+
+void Game::setFrameRateLimit(unsigned int framesPerSecond) {
+    m_frameRateLimit = framesPerSecond;
+    if (m_frameRateLimit > 0 && m_verticalSync) {
+        m_verticalSync = false;
+        m_window.setVerticalSyncEnabled(false);
+    }
+    m_window.setFramerateLimit(m_frameRateLimit);
+}
+
+void Game::setVerticalSyncEnabled(bool enabled) {
+    m_verticalSync = enabled;
+    if (m_verticalSync && m_frameRateLimit > 0) {
+        m_frameRateLimit = 0;
+        m_window.setFramerateLimit(0);
+    }
+    m_window.setVerticalSyncEnabled(m_verticalSync);
+}
+
+void Game::setMaxCatchUpSteps(int steps) {
+    // At least one tick per frame, or the simulation would never advance
+    if (steps > 0) {
+        m_maxCatchUpSteps = steps;
     }
 }
 
@@ -50,481 +104,103 @@ void Game::processEvents() {
             }
             // Debug: teleport near boss for quick testing
             if (keyPressed->code == sf::Keyboard::Key::T) {
-                if (m_player) {
-                    m_player->setPosition(sf::Vector2f(2250.f, 520.f));
-                }
+                m_world->teleportPlayer(sf::Vector2f(2250.f, 520.f));
+            }
+            // Debug: render cost readout (objects drawn vs culled, draw calls)
+            if (keyPressed->code == sf::Keyboard::Key::F3 && m_hud) {
+                m_hud->setShowRenderStats(!m_hud->isShowingRenderStats());
             }
         }
     }
 }
 
 void Game::update(float deltaTime) {
-    // Update effects manager and check for hit freeze
-    m_effectsManager.update(deltaTime);
-    
-    // Skip game updates if hit freeze is active
-    if (m_effectsManager.getHitFreeze().isActive()) {
-        return;
+    // Sample devices once per tick, the simulation only sees the snapshot
+    if (Player* player = m_world->getPlayer()) {
+        player->setInput(InputState::poll());
     }
     
-    // Update moving platforms
-    for (auto& platform : m_platforms) {
-        platform.update(deltaTime);
-    }
-
-    // Update player
-    if (m_player) {
-        m_player->update(deltaTime);
-        handlePlatformCollisions(deltaTime);
-        
-        // Update camera to follow player
-        if (m_camera) {
-            m_camera->update(m_player->getPosition(), deltaTime);
-        }
-    }
-    
-    // Update enemies and set player as target
-    for (auto& enemy : m_enemies) {
-        if (enemy && enemy->isActive()) {
-            enemy->setTarget(m_player->getPosition());
-            enemy->update(deltaTime);
-        }
-    }
-    
-    // Update boss
-    if (m_boss && m_boss->isActive()) {
-        m_boss->setTarget(m_player->getPosition());
-        m_boss->update(deltaTime);
-    }
-    
-    // Handle combat (attacks hitting entities)
-    handleCombat();
+    m_world->update(deltaTime);
 }
 
-void Game::render() {
+void Game::render(float alpha) {
     // Clear with a dark background color
     m_window.clear(sf::Color(20, 20, 30));
     
+    Player* player = m_world->getPlayer();
+    Boss* boss = m_world->getBoss();
+    
     // Apply camera view
-    if (m_camera) {
-        m_window.setView(m_camera->getView());
+    if (Camera* camera = m_world->getCamera()) {
+        m_window.setView(camera->getView(alpha));
+        m_culler.begin(camera->getVisibleRect(alpha));
+    } else {
+        const sf::View& view = m_window.getView();
+        m_culler.begin(sf::FloatRect(view.getCenter() - view.getSize() / 2.f, view.getSize()));
+    }
+    
+    // Static platforms are one cached draw; re-bake only when the level changes
+    const std::vector<Platform>& platforms = m_world->getPlatforms();
+    if (m_levelGeometry.isStale(m_world->getLevelRevision())) {
+        m_levelGeometry.build(platforms, m_world->getLevelRevision());
     }
+    m_levelGeometry.render(m_window);
     
-    // Draw ground line (visual reference)
-    sf::RectangleShape ground(sf::Vector2f(WINDOW_WIDTH, 10.f));
-    ground.setPosition(sf::Vector2f(0.f, 600.f));
-    ground.setFillColor(sf::Color(100, 100, 100));
-    m_window.draw(ground);
+    // Draw ground line (visual reference, inside the ground platform's fill)
+    m_spriteBatch.submit(sf::FloatRect(sf::Vector2f(0.f, 600.f), sf::Vector2f(WINDOW_WIDTH, 10.f)),
+                         sf::Color(100, 100, 100), RenderLayer::Level);
     
-    // Render platforms
-    for (const auto& platform : m_platforms) {
-        platform.render(m_window);
+    // Moving platforms go through the batch with this frame's interpolated position
+    for (const auto& platform : platforms) {
+        if (platform.isMoving() && m_culler.isVisible(platform.getBounds())) {
+            platform.render(m_spriteBatch, alpha);
+        }
     }
+    m_spriteBatch.flush(m_window);
+    m_drawCalls = m_spriteBatch.getLastDrawCallCount();
+    
+    // Enemy, boss and projectile particles sit behind the entities
+    ParticleWorld::getInstance().render(m_window, ParticleLayer::BehindEntities, m_culler);
     
     // Render enemies
-    for (const auto& enemy : m_enemies) {
-        if (enemy && enemy->isActive()) {
-            enemy->render(m_window);
+    for (const auto& enemy : m_world->getEnemies()) {
+        if (enemy && enemy->isActive() && m_culler.isVisible(enemy->getBounds())) {
+            enemy->renderInterpolated(m_spriteBatch, alpha);
         }
     }
     
+    // Every shot in the level goes into the batch as one run of triangles
+    m_world->getProjectiles().render(m_spriteBatch, m_culler);
+    
     // Render boss
-    if (m_boss && m_boss->isActive()) {
-        m_boss->render(m_window);
+    if (boss && boss->isActive() && m_culler.isVisible(boss->getBounds())) {
+        boss->renderInterpolated(m_spriteBatch, alpha);
     }
     
     // Render player
-    if (m_player) {
-        m_player->render(m_window);
+    if (player && m_culler.isVisible(player->getBounds())) {
+        player->renderInterpolated(m_spriteBatch, alpha);
     }
     
+    // All entity sprites share the atlas page, so this is only a few draws
+    m_spriteBatch.flush(m_window);
+    m_drawCalls += m_spriteBatch.getLastDrawCallCount();
+    
+    // Player particles draw over everything in the world
+    ParticleWorld::getInstance().render(m_window, ParticleLayer::AboveEntities, m_culler);
+    
     // Render visual effects (flash effects, attack trails, etc.)
-    m_effectsManager.render(m_window);
+    m_world->getEffectsManager().render(m_window, m_culler);
 
     // Switch to default view for HUD (screen-space coordinates)
     m_window.setView(m_window.getDefaultView());
     
     // Render HUD overlay
     if (m_hud) {
-        m_hud->render(m_window, m_player.get(), m_boss.get());
+        m_hud->setRenderStats(m_culler.getStats(), m_drawCalls);
+        m_hud->render(m_window, player, boss);
     }
     
     // Display everything
     m_window.display();
 }
-
-void Game::initializeLevel() {
-    // Create a larger test level that requires camera scrolling
-    
-    // Ground platform (extended width for scrolling)
-    m_platforms.emplace_back(0.f, 600.f, 2560.f, 120.f, Platform::Type::Solid);
-    
-    // Starting area - staircase up
-    m_platforms.emplace_back(200.f, 500.f, 150.f, 20.f, Platform::Type::OneWay);
-    m_platforms.emplace_back(400.f, 400.f, 150.f, 20.f, Platform::Type::OneWay);
-    m_platforms.emplace_back(600.f, 300.f, 150.f, 20.f, Platform::Type::OneWay);
-    m_platforms.emplace_back(800.f, 200.f, 150.f, 20.f, Platform::Type::OneWay);
-    
-    // Wall jump challenge area - tall walls for wall slide/jump practice
-    m_platforms.emplace_back(950.f, 200.f, 20.f, 400.f, Platform::Type::Solid);  // Left wall
-    m_platforms.emplace_back(1200.f, 300.f, 20.f, 300.f, Platform::Type::Solid);  // Right wall
-    
-    // High platform area
-    m_platforms.emplace_back(1000.f, 150.f, 300.f, 20.f, Platform::Type::Solid);
-    m_platforms.emplace_back(1100.f, 250.f, 100.f, 20.f, Platform::Type::OneWay);
-    
-    // Mid-section with gaps and walls
-    m_platforms.emplace_back(1400.f, 450.f, 150.f, 20.f, Platform::Type::OneWay);
-    m_platforms.emplace_back(1550.f, 350.f, 20.f, 250.f, Platform::Type::Solid);  // Wall for practice
-    m_platforms.emplace_back(1600.f, 350.f, 150.f, 20.f, Platform::Type::OneWay);
-    m_platforms.emplace_back(1800.f, 250.f, 150.f, 20.f, Platform::Type::OneWay);
-    
-    // End area - descending
-    m_platforms.emplace_back(2000.f, 200.f, 150.f, 20.f, Platform::Type::OneWay);
-    m_platforms.emplace_back(2200.f, 300.f, 150.f, 20.f, Platform::Type::OneWay);
-    m_platforms.emplace_back(2350.f, 450.f, 200.f, 20.f, Platform::Type::OneWay);
-    
-    // Some floating challenge platforms with wall jump opportunities
-    m_platforms.emplace_back(100.f, 250.f, 80.f, 20.f, Platform::Type::OneWay);
-    m_platforms.emplace_back(1350.f, 150.f, 80.f, 20.f, Platform::Type::OneWay);
-    m_platforms.emplace_back(1280.f, 200.f, 20.f, 200.f, Platform::Type::Solid);  // Tall wall for wall climbing
-
-    // Moving platforms (test section)
-    // Horizontal moving platform: moves 200px at 80 px/s
-    m_platforms.emplace_back(300.f, 520.f, 140.f, 18.f, Platform::Type::Moving, sf::Vector2f(1.f, 0.f), 200.f, 80.f);
-    // Vertical moving platform: moves 120px at 60 px/s
-    m_platforms.emplace_back(1700.f, 320.f, 120.f, 18.f, Platform::Type::Moving, sf::Vector2f(0.f, -1.f), 120.f, 60.f);
-    
-    // Spawn varied enemies at strategic locations
-    // Starting area - basic melee enemy
-    m_enemies.push_back(std::make_unique<Enemy>(sf::Vector2f(500.f, 530.f), 150.f, Enemy::EnemyType::Melee));
-    
-    // Wall jump area - flying enemy to test aerial combat
-    m_enemies.push_back(std::make_unique<Enemy>(sf::Vector2f(1100.f, 350.f), 200.f, Enemy::EnemyType::Flying));
-    
-    // Mid section - ranged enemy on platform
-    m_enemies.push_back(std::make_unique<Enemy>(sf::Vector2f(1450.f, 380.f), 100.f, Enemy::EnemyType::Ranged));
-    
-    // Tank enemy before high platform
-    m_enemies.push_back(std::make_unique<Enemy>(sf::Vector2f(900.f, 530.f), 180.f, Enemy::EnemyType::Tank));
-    
-    // Late area mix - ranged and melee
-    m_enemies.push_back(std::make_unique<Enemy>(sf::Vector2f(1800.f, 180.f), 100.f, Enemy::EnemyType::Ranged));
-    m_enemies.push_back(std::make_unique<Enemy>(sf::Vector2f(2000.f, 130.f), 120.f, Enemy::EnemyType::Melee));
-    
-    // Pre-boss gauntlet
-    m_enemies.push_back(std::make_unique<Enemy>(sf::Vector2f(2100.f, 530.f), 150.f, Enemy::EnemyType::Flying));
-    
-    // Spawn boss at the end of the level
-    m_boss = std::make_unique<Boss>(Boss::BossType::Executioner, sf::Vector2f(2300.f, 510.f));
-}
-
-void Game::handlePlatformCollisions(float deltaTime) {
-    if (!m_player) return;
-    
-    sf::FloatRect playerBounds = m_player->getBounds();
-    sf::Vector2f playerVelocity = m_player->getVelocity();
-    
-    bool onGround = false;
-    bool onWall = false;
-    bool wallOnRight = false;
-    bool onLedge = false;
-    sf::Vector2f ledgePosition;
-    
-    for (const auto& platform : m_platforms) {
-        sf::FloatRect platformBounds = platform.getBounds();
-        
-        // Check for collision
-        if (playerBounds.findIntersection(platformBounds).has_value()) {
-            // Determine collision side based on overlap
-            float overlapLeft = (playerBounds.position.x + playerBounds.size.x) - platformBounds.position.x;
-            float overlapRight = (platformBounds.position.x + platformBounds.size.x) - playerBounds.position.x;
-            float overlapTop = (playerBounds.position.y + playerBounds.size.y) - platformBounds.position.y;
-            float overlapBottom = (platformBounds.position.y + platformBounds.size.y) - playerBounds.position.y;
-            
-            // Find minimum overlap (primary collision direction)
-            float minOverlap = std::min(std::min(overlapLeft, overlapRight), 
-                                        std::min(overlapTop, overlapBottom));
-            
-            // One-way platforms: only resolve top collisions when falling and approaching from above
-            if (platform.isOneWay()) {
-                bool feetAboveTop = (playerBounds.position.y + playerBounds.size.y) <= (platformBounds.position.y + 6.f);
-                if (minOverlap == overlapTop && playerVelocity.y > 0 && feetAboveTop) {
-                    m_player->setPosition(playerBounds.position.x,
-                                          platformBounds.position.y - playerBounds.size.y);
-                    m_player->setVelocity(playerVelocity.x, 0.f);
-                    onGround = true;
-                }
-                // Ignore side and bottom collisions for one-way platforms
-                continue;
-            }
-
-            // Resolve collision based on direction (solid/moving)
-            if (minOverlap == overlapTop && playerVelocity.y > 0) {
-                // Collision from top (player landing on platform)
-                m_player->setPosition(playerBounds.position.x, 
-                                     platformBounds.position.y - playerBounds.size.y);
-                m_player->setVelocity(playerVelocity.x, 0.f);
-                onGround = true;
-
-                // Carry the player with moving platforms horizontally
-                if (platform.isMoving()) {
-                    sf::Vector2f pv = platform.getVelocity();
-                    m_player->setPosition(m_player->getPosition().x + pv.x * deltaTime,
-                                          m_player->getPosition().y);
-                }
-            }
-            else if (minOverlap == overlapBottom && playerVelocity.y < 0) {
-                // Collision from bottom (player hitting head)
-                m_player->setPosition(playerBounds.position.x, 
-                                     platformBounds.position.y + platformBounds.size.y);
-                m_player->setVelocity(playerVelocity.x, 0.f);
-                
-                // Check for ledge grab on platform edge
-                if (!onGround) {
-                    float platformLeftEdge = platformBounds.position.x;
-                    float platformRightEdge = platformBounds.position.x + platformBounds.size.x;
-                    float playerCenterX = playerBounds.position.x + playerBounds.size.x / 2.f;
-                    
-                    // Check if player is near edge and can grab
-                    if (playerCenterX > platformLeftEdge - 40.f && playerCenterX < platformLeftEdge + 40.f) {
-                        onLedge = true;
-                        ledgePosition = sf::Vector2f(platformLeftEdge - 5.f, platformBounds.position.y);
-                    } else if (playerCenterX > platformRightEdge - 40.f && playerCenterX < platformRightEdge + 40.f) {
-                        onLedge = true;
-                        ledgePosition = sf::Vector2f(platformRightEdge + 5.f, platformBounds.position.y);
-                    }
-                }
-            }
-            else if (minOverlap == overlapLeft && !onGround) {
-                // Collision from left - wall on left side
-                m_player->setPosition(platformBounds.position.x - playerBounds.size.x, 
-                                     playerBounds.position.y);
-                m_player->setVelocity(0.f, playerVelocity.y);
-                onWall = true;
-                wallOnRight = false;
-            }
-            else if (minOverlap == overlapRight && !onGround) {
-                // Collision from right - wall on right side
-                m_player->setPosition(platformBounds.position.x + platformBounds.size.x, 
-                                     playerBounds.position.y);
-                m_player->setVelocity(0.f, playerVelocity.y);
-                onWall = true;
-                wallOnRight = true;
-            }
-        }
-    }
-    
-    m_player->setOnGround(onGround);
-    
-    // Update wall state
-    if (!onGround) {
-        m_player->setOnWall(onWall, wallOnRight);
-    } else {
-        m_player->setOnWall(false, false);
-    }
-    
-    // Update ledge state (independent of wall/ground)
-    if (onLedge && !onGround) {
-        m_player->setOnLedge(true, ledgePosition);
-    } else {
-        m_player->setOnLedge(false, sf::Vector2f(0.f, 0.f));
-    }
-}
-
-void Game::handleCombat() {
-    if (!m_player) return;
-    
-    // Check player attacks hitting enemies
-    const auto& playerAttacks = m_player->getActiveAttacks();
-    for (const auto& attack : playerAttacks) {
-        if (!attack || !attack->isActive()) continue;
-        
-        sf::FloatRect attackHitbox = attack->getHitbox();
-        
-        // Check each enemy
-        for (auto& enemy : m_enemies) {
-            if (!enemy || !enemy->isActive() || enemy->isDead()) continue;
-            
-            sf::FloatRect enemyBounds = enemy->getBounds();
-            
-            // Check if attack hits enemy
-            if (Physics::checkCollision(attackHitbox, enemyBounds)) {
-                int damage = attack->getDamage();
-                enemy->takeDamage(damage);
-                
-                // Add flash effect on hit
-                sf::Vector2f hitPos(
-                    enemyBounds.position.x + enemyBounds.size.x / 2,
-                    enemyBounds.position.y + enemyBounds.size.y / 2
-                );
-                m_effectsManager.addFlash(hitPos, sf::Color(255, 200, 100), 25.f, 0.15f);
-                
-                // Heavy attacks trigger hit freeze
-                // m_effectsManager.getHitFreeze().trigger(0.08f);  // Disabled for smoother gameplay
-                
-                // Add attack trail
-                m_effectsManager.addAttackTrail(
-                    sf::Vector2f(attackHitbox.position.x, attackHitbox.position.y),
-                    sf::Vector2f(attackHitbox.position.x + attackHitbox.size.x, attackHitbox.position.y + attackHitbox.size.y / 2),
-                    sf::Color(255, 150, 50),
-                    0.2f
-                );
-            }
-        }
-    }
-    
-    // Check enemy attacks hitting player
-    for (const auto& enemy : m_enemies) {
-        if (!enemy || !enemy->isActive() || enemy->isDead()) continue;
-        
-        // Check enemy projectiles hitting player
-        for (const auto& projectile : enemy->getProjectiles()) {
-            if (!projectile || !projectile->isActive()) continue;
-            
-            sf::FloatRect projectileBounds = projectile->getBounds();
-            sf::FloatRect playerBounds = m_player->getBounds();
-            
-            if (Physics::checkCollision(projectileBounds, playerBounds)) {
-                projectile->deactivate();
-                
-                if (m_player->isParrying()) {
-                    const bool perfect = m_player->isPerfectParryWindow();
-                    m_effectsManager.getHitFreeze().trigger(perfect ? 0.08f : 0.05f);
-                    if (m_camera) {
-                        m_camera->shake(perfect ? 6.f : 4.f, perfect ? 0.15f : 0.1f);
-                    }
-                    // Parry projectile flash
-                    sf::Vector2f parryPos(playerBounds.position.x + playerBounds.size.x / 2, playerBounds.position.y + playerBounds.size.y / 2);
-                    m_effectsManager.addFlash(parryPos, perfect ? sf::Color(170, 230, 255) : sf::Color(120, 210, 255), perfect ? 35.f : 25.f, perfect ? 0.2f : 0.15f);
-                } else {
-                    m_player->takeDamage(projectile->getDamage());
-                    if (m_camera && !m_player->isInvulnerable()) {
-                        m_camera->shake(8.f, 0.2f);
-                        sf::Vector2f hitPos(playerBounds.position.x + playerBounds.size.x / 2, playerBounds.position.y + playerBounds.size.y / 2);
-                        m_effectsManager.addFlash(hitPos, sf::Color(255, 50, 50), 18.f, 0.12f);
-                    }
-                }
-            }
-        }
-        
-        // Check melee attacks
-        if (enemy->isAttacking()) {
-            sf::FloatRect enemyAttackHitbox = enemy->getAttackHitbox();
-            sf::FloatRect playerBounds = m_player->getBounds();
-            
-            // Check if enemy attack hits player
-            if (Physics::checkCollision(enemyAttackHitbox, playerBounds)) {
-                // Check if player is parrying
-                if (m_player->isParrying()) {
-                    const bool perfect = m_player->isPerfectParryWindow();
-                    // Hitstop for feedback
-                    m_effectsManager.getHitFreeze().trigger(perfect ? 0.10f : 0.06f);
-                    if (m_camera) {
-                        m_camera->shake(perfect ? 8.f : 5.f, perfect ? 0.2f : 0.15f);
-                    }
-                    // Parry flash effect (bigger/brighter on perfect)
-                    sf::Vector2f parryPos(
-                        playerBounds.position.x + playerBounds.size.x / 2,
-                        playerBounds.position.y + playerBounds.size.y / 2
-                    );
-                    m_effectsManager.addFlash(parryPos,
-                        perfect ? sf::Color(170, 230, 255) : sf::Color(120, 210, 255),
-                        perfect ? 45.f : 32.f,
-                        perfect ? 0.25f : 0.18f);
-                } else {
-                    // Player takes damage (Entity handles invulnerability)
-                    m_player->takeDamage(enemy->getAttackDamage());
-                    // Shake only if damage applied (not invulnerable)
-                    if (m_camera && !m_player->isInvulnerable()) {
-                        m_camera->shake(12.f, 0.3f);
-                        
-                        // Add hit flash on player
-                        sf::Vector2f hitPos(
-                            playerBounds.position.x + playerBounds.size.x / 2,
-                            playerBounds.position.y + playerBounds.size.y / 2
-                        );
-                        m_effectsManager.addFlash(hitPos, sf::Color(255, 50, 50), 20.f, 0.15f);
-                        // m_effectsManager.getHitFreeze().trigger(0.05f);  // Disabled for smoother gameplay
-                    }
-                }
-            }
-        }
-    }
-    
-    // Boss vs Player combat
-    if (m_boss && m_boss->isActive()) {
-        // Check if boss attacks hit player
-        if (m_boss->isAttacking()) {
-            sf::FloatRect bossAttackHitbox = m_boss->getAttackHitbox();
-            sf::FloatRect playerBounds = m_player->getBounds();
-            
-            if (Physics::checkCollision(bossAttackHitbox, playerBounds)) {
-                if (m_player->isParrying()) {
-                    const bool perfect = m_player->isPerfectParryWindow();
-                    m_effectsManager.getHitFreeze().trigger(perfect ? 0.12f : 0.08f);
-                    if (m_camera) {
-                        m_camera->shake(perfect ? 12.f : 8.f, perfect ? 0.28f : 0.2f);
-                    }
-                    // Add intense parry flash (bigger on perfect)
-                    sf::Vector2f parryPos(
-                        playerBounds.position.x + playerBounds.size.x / 2,
-                        playerBounds.position.y + playerBounds.size.y / 2
-                    );
-                    m_effectsManager.addFlash(parryPos,
-                        perfect ? sf::Color(190, 240, 255) : sf::Color(150, 220, 255),
-                        perfect ? 55.f : 40.f,
-                        perfect ? 0.3f : 0.25f);
-                } else {
-                    m_player->takeDamage(m_boss->getAttackDamage());
-                    if (m_camera && !m_player->isInvulnerable()) {
-                        m_camera->shake(15.f, 0.4f);  // Stronger shake for boss hits
-                        
-                        // Add strong hit flash
-                        sf::Vector2f hitPos(
-                            playerBounds.position.x + playerBounds.size.x / 2,
-                            playerBounds.position.y + playerBounds.size.y / 2
-                        );
-                        m_effectsManager.addFlash(hitPos, sf::Color(255, 100, 100), 35.f, 0.2f);
-                        // m_effectsManager.getHitFreeze().trigger(0.12f);  // Longer freeze for boss hits - Disabled for smoother gameplay
-                    }
-                }
-            }
-        }
-        
-        // Check if player attacks hit boss
-        for (const auto& attack : m_player->getActiveAttacks()) {
-            if (attack && attack->isActive()) {
-                sf::FloatRect attackHitbox = attack->getHitbox();
-                sf::FloatRect bossBounds = m_boss->getBounds();
-                
-                if (Physics::checkCollision(attackHitbox, bossBounds)) {
-                    int damage = attack->getDamage();
-                    m_boss->takeDamage(damage);
-                    if (m_camera) {
-                        m_camera->shake(10.f, 0.25f);
-                    }
-                    
-                    // Add powerful hit flash for boss
-                    sf::Vector2f hitPos(
-                        bossBounds.position.x + bossBounds.size.x / 2,
-                        bossBounds.position.y + bossBounds.size.y / 2
-                    );
-                    m_effectsManager.addFlash(hitPos, sf::Color(255, 180, 80), 35.f, 0.2f);
-                    
-                    // Heavy attacks on boss trigger longer freeze
-                    // m_effectsManager.getHitFreeze().trigger(0.1f);  // Disabled for smoother gameplay
-                    
-                    // Add attack trail for boss hits
-                    m_effectsManager.addAttackTrail(
-                        sf::Vector2f(attackHitbox.position.x, attackHitbox.position.y),
-                        sf::Vector2f(attackHitbox.position.x + attackHitbox.size.x, attackHitbox.position.y + attackHitbox.size.y / 2),
-                        sf::Color(255, 200, 100),
-                        0.25f
-                    );
-                }
-            }
-        }
-    }
-}
-
@@ -0,0 +1,555 @@
+#include "GameWorld.hpp"
+#include "Physics.hpp"
+#include "Attack.hpp"
+#include "EntitySystems.hpp"
+#include "ParticleWorld.hpp"
+#include <algorithm>
+#include <cmath>
+
+GameWorld::GameWorld(float viewWidth, float viewHeight)
+    : m_player(std::make_unique<Player>(m_entityStore))
+    , m_camera(std::make_unique<Camera>(viewWidth, viewHeight))
+{
+    initializeLevel();
+    m_platformGrid.build(m_platforms);
+    ++m_levelRevision;
+    
+    // Set camera bounds to level size
+    m_camera->setLevelBounds(0.f, 0.f, LEVEL_WIDTH, LEVEL_HEIGHT);
+    
+    // Start interpolation from the spawn positions
+    savePreviousState();
+}
+
+void GameWorld::update(float deltaTime) {
+    // Start of tick: where every move this tick begins
+    savePreviousState();
+    
+    // Update effects manager and check for hit freeze
+    m_effectsManager.update(deltaTime);
+    
+    // Skip game updates if hit freeze is active
+    if (m_effectsManager.getHitFreeze().isActive()) {
+        return;
+    }
+    
+    // Update moving platforms
+    for (auto& platform : m_platforms) {
+        platform.update(deltaTime);
+    }
+    m_platformGrid.refreshDynamic(m_platforms);
+
+    // Update player
+    if (m_player) {
+        m_player->update(deltaTime);
+        handlePlatformCollisions(deltaTime);
+        
+        // Update camera to follow player
+        if (m_camera) {
+            m_camera->update(m_player->getPosition(), deltaTime);
+        }
+    }
+    
+    // Move shots fired on earlier ticks; this tick's shots start from the muzzle
+    m_projectiles.update(deltaTime);
+    
+    // Body step for every enemy in one sweep, then the AI of the enemies scheduled this tick and the boss
+    EntitySystems::updateEnemyBodies(m_entityStore, deltaTime);
+    const sf::FloatRect viewRect = m_camera ? m_camera->getVisibleRect() : sf::FloatRect();
+    m_aiScheduler.update(m_enemies, m_boss.get(), m_player->getPosition(), viewRect, deltaTime);
+    
+    // Land enemies and boss on the level geometry
+    handleBodyCollisions(deltaTime);
+    handleProjectileCollisions();
+    
+    // Advance every particle emitted this tick (shared pool for all entities)
+    ParticleWorld::getInstance().update(deltaTime);
+    
+    // Handle combat (attacks hitting entities)
+    handleCombat();
+    despawnDeadEnemies();
+}
+
+
+void GameWorld::savePreviousState() {
+    for (auto& platform : m_platforms) {
+        platform.savePreviousState();
+    }
+    EntitySystems::savePreviousState(m_entityStore);  // Player, enemies and boss
+    if (m_camera) {
+        m_camera->savePreviousState();
+    }
+}
+
+void GameWorld::teleportPlayer(const sf::Vector2f& position) {
+    if (m_player) {
+        m_player->setPosition(position);
+        m_player->savePreviousState();  // Don't interpolate across the jump
+    }
+}
+
+SlotHandle GameWorld::spawnEnemy(const sf::Vector2f& position, float patrolRange, Enemy::EnemyType type) {
+    auto enemy = std::make_unique<Enemy>(m_entityStore, position, patrolRange, type);
+    enemy->setProjectileSystem(&m_projectiles);
+    return m_enemies.insert(std::move(enemy));
+}
+
+void GameWorld::despawnEnemy(SlotHandle handle) {
+    if (std::unique_ptr<Enemy>* enemy = m_enemies.get(handle)) {
+        m_projectiles.releaseOwnedBy(enemy->get());
+        m_enemies.erase(handle);
+    }
+}
+
+Enemy* GameWorld::getEnemy(SlotHandle handle) {
+    std::unique_ptr<Enemy>* enemy = m_enemies.get(handle);
+    return enemy ? enemy->get() : nullptr;
+}
+
+void GameWorld::initializeLevel() {
+    // Create a larger test level that requires camera scrolling
+    
+    // Ground platform (extended width for scrolling)
+    m_platforms.emplace_back(0.f, 600.f, 2560.f, 120.f, Platform::Type::Solid);
+    
+    // Starting area - staircase up
+    m_platforms.emplace_back(200.f, 500.f, 150.f, 20.f, Platform::Type::OneWay);
+    m_platforms.emplace_back(400.f, 400.f, 150.f, 20.f, Platform::Type::OneWay);
+    m_platforms.emplace_back(600.f, 300.f, 150.f, 20.f, Platform::Type::OneWay);
+    m_platforms.emplace_back(800.f, 200.f, 150.f, 20.f, Platform::Type::OneWay);
+    
+    // Wall jump challenge area - tall walls for wall slide/jump practice
+    m_platforms.emplace_back(950.f, 200.f, 20.f, 400.f, Platform::Type::Solid);  // Left wall
+    m_platforms.emplace_back(1200.f, 300.f, 20.f, 300.f, Platform::Type::Solid);  // Right wall
+    
+    // High platform area
+    m_platforms.emplace_back(1000.f, 150.f, 300.f, 20.f, Platform::Type::Solid);
+    m_platforms.emplace_back(1100.f, 250.f, 100.f, 20.f, Platform::Type::OneWay);
+    
+    // Mid-section with gaps and walls
+    m_platforms.emplace_back(1400.f, 450.f, 150.f, 20.f, Platform::Type::OneWay);
+    m_platforms.emplace_back(1550.f, 350.f, 20.f, 250.f, Platform::Type::Solid);  // Wall for practice
+    m_platforms.emplace_back(1600.f, 350.f, 150.f, 20.f, Platform::Type::OneWay);
+    m_platforms.emplace_back(1800.f, 250.f, 150.f, 20.f, Platform::Type::OneWay);
+    
+    // End area - descending
+    m_platforms.emplace_back(2000.f, 200.f, 150.f, 20.f, Platform::Type::OneWay);
+    m_platforms.emplace_back(2200.f, 300.f, 150.f, 20.f, Platform::Type::OneWay);
+    m_platforms.emplace_back(2350.f, 450.f, 200.f, 20.f, Platform::Type::OneWay);
+    
+    // Some floating challenge platforms with wall jump opportunities
+    m_platforms.emplace_back(100.f, 250.f, 80.f, 20.f, Platform::Type::OneWay);
+    m_platforms.emplace_back(1350.f, 150.f, 80.f, 20.f, Platform::Type::OneWay);
+    m_platforms.emplace_back(1280.f, 200.f, 20.f, 200.f, Platform::Type::Solid);  // Tall wall for wall climbing
+
+    // Moving platforms (test section)
+    // Horizontal moving platform: moves 200px at 80 px/s
+    m_platforms.emplace_back(300.f, 520.f, 140.f, 18.f, Platform::Type::Moving, sf::Vector2f(1.f, 0.f), 200.f, 80.f);
+    // Vertical moving platform: moves 120px at 60 px/s
+    m_platforms.emplace_back(1700.f, 320.f, 120.f, 18.f, Platform::Type::Moving, sf::Vector2f(0.f, -1.f), 120.f, 60.f);
+    
+    // Spawn varied enemies at strategic locations
+    // Starting area - basic melee enemy
+    spawnEnemy(sf::Vector2f(500.f, 530.f), 150.f, Enemy::EnemyType::Melee);
+    
+    // Wall jump area - flying enemy to test aerial combat
+    spawnEnemy(sf::Vector2f(1100.f, 350.f), 200.f, Enemy::EnemyType::Flying);
+    
+    // Mid section - ranged enemy on platform
+    spawnEnemy(sf::Vector2f(1450.f, 380.f), 100.f, Enemy::EnemyType::Ranged);
+    
+    // Tank enemy before high platform
+    spawnEnemy(sf::Vector2f(900.f, 530.f), 180.f, Enemy::EnemyType::Tank);
+    
+    // Late area mix - ranged and melee
+    spawnEnemy(sf::Vector2f(1800.f, 180.f), 100.f, Enemy::EnemyType::Ranged);
+    spawnEnemy(sf::Vector2f(2000.f, 130.f), 120.f, Enemy::EnemyType::Melee);
+    
+    // Pre-boss gauntlet
+    spawnEnemy(sf::Vector2f(2100.f, 530.f), 150.f, Enemy::EnemyType::Flying);
+    
+    // Spawn boss at the end of the level
+    m_boss = std::make_unique<Boss>(m_entityStore, Boss::BossType::Executioner, sf::Vector2f(2300.f, 510.f));
+}
+
+
+void GameWorld::handlePlatformCollisions(float deltaTime) {
+    if (!m_player) return;
+    
+    // Only platforms near the player's path can intersect it (results stay in level order)
+    m_platformGrid.query(CollisionSystem::getSweptBounds(*m_player), m_platformQuery);
+    
+    // Stop dashes and fast falls at the first platform crossed, not past it
+    CollisionSystem::sweepMove(*m_player, m_platforms, m_platformQuery);
+    
+    sf::FloatRect playerBounds = m_player->getBounds();
+    sf::Vector2f playerVelocity = m_player->getVelocity();
+    
+    bool onGround = false;
+    bool onWall = false;
+    bool wallOnRight = false;
+    bool onLedge = false;
+    sf::Vector2f ledgePosition;
+    
+    for (std::size_t index : m_platformQuery) {
+        const Platform& platform = m_platforms[index];
+        sf::FloatRect platformBounds = platform.getBounds();
+        
+        // Check for collision
+        if (playerBounds.findIntersection(platformBounds).has_value()) {
+            // Determine collision side based on overlap
+            float overlapLeft = (playerBounds.position.x + playerBounds.size.x) - platformBounds.position.x;
+            float overlapRight = (platformBounds.position.x + platformBounds.size.x) - playerBounds.position.x;
+            float overlapTop = (playerBounds.position.y + playerBounds.size.y) - platformBounds.position.y;
+            float overlapBottom = (platformBounds.position.y + platformBounds.size.y) - playerBounds.position.y;
+            
+            // Find minimum overlap (primary collision direction)
+            float minOverlap = std::min(std::min(overlapLeft, overlapRight), 
+                                        std::min(overlapTop, overlapBottom));
+            
+            // One-way platforms: only resolve top collisions when falling and approaching from above
+            if (platform.isOneWay()) {
+                bool feetAboveTop = (playerBounds.position.y + playerBounds.size.y) <= (platformBounds.position.y + 6.f);
+                if (minOverlap == overlapTop && playerVelocity.y > 0 && feetAboveTop) {
+                    m_player->setPosition(playerBounds.position.x,
+                                          platformBounds.position.y - playerBounds.size.y);
+                    m_player->setVelocity(playerVelocity.x, 0.f);
+                    onGround = true;
+                }
+                // Ignore side and bottom collisions for one-way platforms
+                continue;
+            }
+
+            // Resolve collision based on direction (solid/moving)
+            if (minOverlap == overlapTop && playerVelocity.y > 0) {
+                // Collision from top (player landing on platform)
+                m_player->setPosition(playerBounds.position.x, 
+                                     platformBounds.position.y - playerBounds.size.y);
+                m_player->setVelocity(playerVelocity.x, 0.f);
+                onGround = true;
+
+                // Carry the player with moving platforms horizontally
+                if (platform.isMoving()) {
+                    sf::Vector2f pv = platform.getVelocity();
+                    m_player->setPosition(m_player->getPosition().x + pv.x * deltaTime,
+                                          m_player->getPosition().y);
+                }
+            }
+            else if (minOverlap == overlapBottom && playerVelocity.y < 0) {
+                // Collision from bottom (player hitting head)
+                m_player->setPosition(playerBounds.position.x, 
+                                     platformBounds.position.y + platformBounds.size.y);
+                m_player->setVelocity(playerVelocity.x, 0.f);
+                
+                // Check for ledge grab on platform edge
+                if (!onGround) {
+                    float platformLeftEdge = platformBounds.position.x;
+                    float platformRightEdge = platformBounds.position.x + platformBounds.size.x;
+                    float playerCenterX = playerBounds.position.x + playerBounds.size.x / 2.f;
+                    
+                    // Check if player is near edge and can grab
+                    if (playerCenterX > platformLeftEdge - 40.f && playerCenterX < platformLeftEdge + 40.f) {
+                        onLedge = true;
+                        ledgePosition = sf::Vector2f(platformLeftEdge - 5.f, platformBounds.position.y);
+                    } else if (playerCenterX > platformRightEdge - 40.f && playerCenterX < platformRightEdge + 40.f) {
+                        onLedge = true;
+                        ledgePosition = sf::Vector2f(platformRightEdge + 5.f, platformBounds.position.y);
+                    }
+                }
+            }
+            else if (minOverlap == overlapLeft && !onGround) {
+                // Collision from left - wall on left side
+                m_player->setPosition(platformBounds.position.x - playerBounds.size.x, 
+                                     playerBounds.position.y);
+                m_player->setVelocity(0.f, playerVelocity.y);
+                onWall = true;
+                wallOnRight = false;
+            }
+            else if (minOverlap == overlapRight && !onGround) {
+                // Collision from right - wall on right side
+                m_player->setPosition(platformBounds.position.x + platformBounds.size.x, 
+                                     playerBounds.position.y);
+                m_player->setVelocity(0.f, playerVelocity.y);
+                onWall = true;
+                wallOnRight = true;
+            }
+        }
+    }
+    
+    m_player->setOnGround(onGround);
+    
+    // Update wall state
+    if (!onGround) {
+        m_player->setOnWall(onWall, wallOnRight);
+    } else {
+        m_player->setOnWall(false, false);
+    }
+    
+    // Update ledge state (independent of wall/ground)
+    if (onLedge && !onGround) {
+        m_player->setOnLedge(true, ledgePosition);
+    } else {
+        m_player->setOnLedge(false, sf::Vector2f(0.f, 0.f));
+    }
+}
+
+void GameWorld::handleBodyCollisions(float deltaTime) {
+    m_bodies.clear();
+    for (auto& enemy : m_enemies) {
+        // Flying enemies hover freely and are not blocked by platforms
+        if (enemy && enemy->isActive() && enemy->getType() != Enemy::EnemyType::Flying) {
+            m_bodies.emplace_back(enemy.get());
+        }
+    }
+    if (m_boss && m_boss->isActive()) {
+        m_bodies.emplace_back(m_boss.get());
+    }
+    
+    m_collisionSystem.resolve(m_bodies, m_platforms, m_platformGrid, deltaTime);
+    
+    for (const auto& body : m_bodies) {
+        body.entity->onPlatformContact(body.contacts);
+    }
+}
+
+void GameWorld::handleProjectileCollisions() {
+    for (std::size_t i = 0; i < m_projectiles.size(); ++i) {
+        if (!m_projectiles.isActive(i)) continue;
+        
+        sf::FloatRect bounds = m_projectiles.getBounds(i);
+        sf::FloatRect previousBounds = m_projectiles.getPreviousBounds(i);
+        sf::Vector2f displacement = bounds.position - previousBounds.position;
+        
+        // Broadphase over the whole path so fast shots can't skip a thin wall
+        sf::FloatRect path(sf::Vector2f(std::min(bounds.position.x, previousBounds.position.x),
+                                        std::min(bounds.position.y, previousBounds.position.y)),
+                           bounds.size + sf::Vector2f(std::abs(displacement.x), std::abs(displacement.y)));
+        m_platformGrid.query(path, m_platformQuery);
+        
+        for (std::size_t index : m_platformQuery) {
+            const Platform& platform = m_platforms[index];
+            // Shots pass through one-way platforms like the player jumping up through them
+            if (platform.isOneWay()) continue;
+            
+            sf::FloatRect platformBounds = platform.getBounds();
+            if (Physics::checkCollision(bounds, platformBounds) ||
+                Physics::sweepAABB(previousBounds, displacement, platformBounds).hit) {
+                m_projectiles.deactivate(i);
+                break;
+            }
+        }
+    }
+}
+
+void GameWorld::handleCombat() {
+    if (!m_player) return;
+    
+    // Check player attacks hitting enemies
+    const AttackPool& playerAttacks = m_player->getActiveAttacks();
+    for (std::size_t i = 0; i < playerAttacks.getActiveCount(); ++i) {
+        const Attack& attack = playerAttacks.getActive(i);
+        if (!attack.isActive()) continue;
+        
+        sf::FloatRect attackHitbox = attack.getHitbox();
+        
+        // Check each enemy
+        for (auto& enemy : m_enemies) {
+            if (!enemy || !enemy->isActive() || enemy->isDead()) continue;
+            
+            sf::FloatRect enemyBounds = enemy->getBounds();
+            
+            // Check if attack hits enemy
+            if (Physics::checkCollision(attackHitbox, enemyBounds)) {
+                int damage = attack.getDamage();
+                enemy->takeDamage(damage);
+                
+                // Add flash effect on hit
+                sf::Vector2f hitPos(
+                    enemyBounds.position.x + enemyBounds.size.x / 2,
+                    enemyBounds.position.y + enemyBounds.size.y / 2
+                );
+                m_effectsManager.addFlash(hitPos, sf::Color(255, 200, 100), 25.f, 0.15f);
+                
+                // Heavy attacks trigger hit freeze
+                // m_effectsManager.getHitFreeze().trigger(0.08f);  // Disabled for smoother gameplay
+                
+                // Add attack trail
+                m_effectsManager.addAttackTrail(
+                    sf::Vector2f(attackHitbox.position.x, attackHitbox.position.y),
+                    sf::Vector2f(attackHitbox.position.x + attackHitbox.size.x, attackHitbox.position.y + attackHitbox.size.y / 2),
+                    sf::Color(255, 150, 50),
+                    0.2f
+                );
+            }
+        }
+    }
+    
+    // Check enemy projectiles hitting player (one pass over every shot in the level)
+    const sf::FloatRect playerBounds = m_player->getBounds();
+    for (std::size_t i = 0; i < m_projectiles.size(); ++i) {
+        if (!m_projectiles.isActive(i)) continue;
+
+        // A shooter's shots vanish with it
+        const Entity* owner = m_projectiles.getOwner(i);
+        if (owner && owner->isDead()) {
+            m_projectiles.deactivate(i);
+            continue;
+        }
+
+        if (Physics::checkCollision(m_projectiles.getBounds(i), playerBounds)) {
+            m_projectiles.deactivate(i);
+
+            if (m_player->isParrying()) {
+                const bool perfect = m_player->isPerfectParryWindow();
+                m_effectsManager.getHitFreeze().trigger(perfect ? 0.08f : 0.05f);
+                if (m_camera) {
+                    m_camera->shake(perfect ? 6.f : 4.f, perfect ? 0.15f : 0.1f);
+                }
+                // Parry projectile flash
+                sf::Vector2f parryPos(playerBounds.position.x + playerBounds.size.x / 2, playerBounds.position.y + playerBounds.size.y / 2);
+                m_effectsManager.addFlash(parryPos, perfect ? sf::Color(170, 230, 255) : sf::Color(120, 210, 255), perfect ? 35.f : 25.f, perfect ? 0.2f : 0.15f);
+            } else {
+                m_player->takeDamage(m_projectiles.getDamage(i));
+                if (m_camera && !m_player->isInvulnerable()) {
+                    m_camera->shake(8.f, 0.2f);
+                    sf::Vector2f hitPos(playerBounds.position.x + playerBounds.size.x / 2, playerBounds.position.y + playerBounds.size.y / 2);
+                    m_effectsManager.addFlash(hitPos, sf::Color(255, 50, 50), 18.f, 0.12f);
+                }
+            }
+        }
+    }
+
+    // Check enemy melee attacks hitting player
+    for (const auto& enemy : m_enemies) {
+        if (!enemy || !enemy->isActive() || enemy->isDead()) continue;
+        
+        // Check melee attacks
+        if (enemy->isAttacking()) {
+            sf::FloatRect enemyAttackHitbox = enemy->getAttackHitbox();
+            sf::FloatRect playerBounds = m_player->getBounds();
+            
+            // Check if enemy attack hits player
+            if (Physics::checkCollision(enemyAttackHitbox, playerBounds)) {
+                // Check if player is parrying
+                if (m_player->isParrying()) {
+                    const bool perfect = m_player->isPerfectParryWindow();
+                    // Hitstop for feedback
+                    m_effectsManager.getHitFreeze().trigger(perfect ? 0.10f : 0.06f);
+                    if (m_camera) {
+                        m_camera->shake(perfect ? 8.f : 5.f, perfect ? 0.2f : 0.15f);
+                    }
+                    // Parry flash effect (bigger/brighter on perfect)
+                    sf::Vector2f parryPos(
+                        playerBounds.position.x + playerBounds.size.x / 2,
+                        playerBounds.position.y + playerBounds.size.y / 2
+                    );
+                    m_effectsManager.addFlash(parryPos,
+                        perfect ? sf::Color(170, 230, 255) : sf::Color(120, 210, 255),
+                        perfect ? 45.f : 32.f,
+                        perfect ? 0.25f : 0.18f);
+                } else {
+                    // Player takes damage (Entity handles invulnerability)
+                    m_player->takeDamage(enemy->getAttackDamage());
+                    // Shake only if damage applied (not invulnerable)
+                    if (m_camera && !m_player->isInvulnerable()) {
+                        m_camera->shake(12.f, 0.3f);
+                        
+                        // Add hit flash on player
+                        sf::Vector2f hitPos(
+                            playerBounds.position.x + playerBounds.size.x / 2,
+                            playerBounds.position.y + playerBounds.size.y / 2
+                        );
+                        m_effectsManager.addFlash(hitPos, sf::Color(255, 50, 50), 20.f, 0.15f);
+                        // m_effectsManager.getHitFreeze().trigger(0.05f);  // Disabled for smoother gameplay
+                    }
+                }
+            }
+        }
+    }
+    
+    // Boss vs Player combat
+    if (m_boss && m_boss->isActive()) {
+        // Check if boss attacks hit player
+        if (m_boss->isAttacking()) {
+            sf::FloatRect bossAttackHitbox = m_boss->getAttackHitbox();
+            sf::FloatRect playerBounds = m_player->getBounds();
+            
+            if (Physics::checkCollision(bossAttackHitbox, playerBounds)) {
+                if (m_player->isParrying()) {
+                    const bool perfect = m_player->isPerfectParryWindow();
+                    m_effectsManager.getHitFreeze().trigger(perfect ? 0.12f : 0.08f);
+                    if (m_camera) {
+                        m_camera->shake(perfect ? 12.f : 8.f, perfect ? 0.28f : 0.2f);
+                    }
+                    // Add intense parry flash (bigger on perfect)
+                    sf::Vector2f parryPos(
+                        playerBounds.position.x + playerBounds.size.x / 2,
+                        playerBounds.position.y + playerBounds.size.y / 2
+                    );
+                    m_effectsManager.addFlash(parryPos,
+                        perfect ? sf::Color(190, 240, 255) : sf::Color(150, 220, 255),
+                        perfect ? 55.f : 40.f,
+                        perfect ? 0.3f : 0.25f);
+                } else {
+                    m_player->takeDamage(m_boss->getAttackDamage());
+                    if (m_camera && !m_player->isInvulnerable()) {
+                        m_camera->shake(15.f, 0.4f);  // Stronger shake for boss hits
+                        
+                        // Add strong hit flash
+                        sf::Vector2f hitPos(
+                            playerBounds.position.x + playerBounds.size.x / 2,
+                            playerBounds.position.y + playerBounds.size.y / 2
+                        );
+                        m_effectsManager.addFlash(hitPos, sf::Color(255, 100, 100), 35.f, 0.2f);
+                        // m_effectsManager.getHitFreeze().trigger(0.12f);  // Longer freeze for boss hits - Disabled for smoother gameplay
+                    }
+                }
+            }
+        }
+        
+        // Check if player attacks hit boss
+        const AttackPool& playerAttacks = m_player->getActiveAttacks();
+        for (std::size_t i = 0; i < playerAttacks.getActiveCount(); ++i) {
+            const Attack& attack = playerAttacks.getActive(i);
+            if (attack.isActive()) {
+                sf::FloatRect attackHitbox = attack.getHitbox();
+                sf::FloatRect bossBounds = m_boss->getBounds();
+                
+                if (Physics::checkCollision(attackHitbox, bossBounds)) {
+                    int damage = attack.getDamage();
+                    m_boss->takeDamage(damage);
+                    if (m_camera) {
+                        m_camera->shake(10.f, 0.25f);
+                    }
+                    
+                    // Add powerful hit flash for boss
+                    sf::Vector2f hitPos(
+                        bossBounds.position.x + bossBounds.size.x / 2,
+                        bossBounds.position.y + bossBounds.size.y / 2
+                    );
+                    m_effectsManager.addFlash(hitPos, sf::Color(255, 180, 80), 35.f, 0.2f);
+                    
+                    // Heavy attacks on boss trigger longer freeze
+                    // m_effectsManager.getHitFreeze().trigger(0.1f);  // Disabled for smoother gameplay
+                    
+                    // Add attack trail for boss hits
+                    m_effectsManager.addAttackTrail(
+                        sf::Vector2f(attackHitbox.position.x, attackHitbox.position.y),
+                        sf::Vector2f(attackHitbox.position.x + attackHitbox.size.x, attackHitbox.position.y + attackHitbox.size.y / 2),
+                        sf::Color(255, 200, 100),
+                        0.25f
+                    );
+                }
+            }
+        }
+    }
+}
+
+void GameWorld::despawnDeadEnemies() {
+    m_enemies.eraseIf([this](const std::unique_ptr<Enemy>& enemy) {
+        if (!enemy->isDead()) return false;
+        
+        m_projectiles.releaseOwnedBy(enemy.get());
+        return true;
+    });
+}
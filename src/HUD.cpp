@@ -1,15 +1,123 @@
 #include "HUD.hpp"
 #include "Player.hpp"
 #include "Boss.hpp"
+#include <algorithm>
 #include <cmath>
+#include <ctime>
+#include <iostream>
+
+namespace {
+    // The cache holds premultiplied colour (blending onto transparent pixels), so composite it as such
+    const sf::BlendMode BLEND_PREMULTIPLIED(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+}
 
 HUD::HUD(unsigned int windowWidth, unsigned int windowHeight)
     : m_windowWidth(windowWidth)
     , m_windowHeight(windowHeight)
     , m_fontLoaded(false)
+    , m_cacheReady(false)
+    , m_cacheDirty(true)
+    , m_showRenderStats(false)
+    , m_drawCalls(0)
 {
     // In production, load actual font file here
     // For now, we'll work without text rendering (SFML 3 requires explicit fonts)
+
+    m_cacheReady = m_cache.resize({windowWidth, windowHeight});
+    if (!m_cacheReady) {
+        std::cerr << "Failed to create HUD render texture, drawing the HUD every frame" << std::endl;
+        return;
+    }
+    m_cache.clear(sf::Color::Transparent);
+    drawChrome(m_cache);
+}
+
+void HUD::drawChrome(sf::RenderTarget& target) {
+    // ===== BOTTOM CENTER: Debug Info =====
+    #ifdef _DEBUG
+    {
+        float debugX = m_windowWidth / 2.f - 100.f;
+        float debugY = m_windowHeight - 60.f;
+
+        // Draw semi-transparent debug background
+        sf::RectangleShape debugBg(sf::Vector2f(200.f, 50.f));
+        debugBg.setFillColor(sf::Color(0, 0, 0, 100));
+        debugBg.setOutlineThickness(1.f);
+        debugBg.setOutlineColor(sf::Color(100, 100, 100));
+        debugBg.setPosition(sf::Vector2f(debugX, debugY));
+        target.draw(debugBg);
+    }
+    #else
+    (void)target;
+    #endif
+}
+
+void HUD::setRenderStats(const CullStats& cullStats, std::size_t drawCalls) {
+    m_cullStats = cullStats;
+    m_drawCalls = drawCalls;
+}
+
+void HUD::invalidate() {
+    for (auto& state : m_widgets) {
+        state.valid = false;
+    }
+}
+
+bool HUD::beginWidget(Widget widget, const WidgetInputs& inputs) {
+    WidgetState& state = m_widgets[static_cast<std::size_t>(widget)];
+    if (state.valid && state.inputs == inputs) {
+        return false;
+    }
+
+    // Wipe what the widget drew last time (its bounds may shrink, e.g. a combo ending)
+    if (m_cacheReady && state.valid && state.bounds.size.x > 0.f && state.bounds.size.y > 0.f) {
+        sf::RectangleShape eraser(state.bounds.size + sf::Vector2f(2.f, 2.f));
+        eraser.setPosition(state.bounds.position - sf::Vector2f(1.f, 1.f));
+        eraser.setFillColor(sf::Color::Transparent);
+        m_cache.draw(eraser, sf::RenderStates(sf::BlendNone));
+    }
+
+    state.inputs = inputs;
+    m_drawBounds = sf::FloatRect();
+    m_cacheDirty = true;
+    return true;
+}
+
+void HUD::endWidget(Widget widget) {
+    WidgetState& state = m_widgets[static_cast<std::size_t>(widget)];
+    state.bounds = m_drawBounds;
+    state.valid = m_cacheReady;  // Without a cache, every frame is a full redraw
+}
+
+void HUD::drawShape(sf::RenderTarget& target, const sf::Shape& shape) {
+    target.draw(shape);
+
+    // Grow the widget's dirty area to cover this shape (outline included)
+    const sf::FloatRect bounds = shape.getGlobalBounds();
+    if (m_drawBounds.size.x <= 0.f && m_drawBounds.size.y <= 0.f) {
+        m_drawBounds = bounds;
+        return;
+    }
+    const sf::Vector2f topLeft(std::min(m_drawBounds.position.x, bounds.position.x),
+                               std::min(m_drawBounds.position.y, bounds.position.y));
+    const sf::Vector2f bottomRight(std::max(m_drawBounds.position.x + m_drawBounds.size.x, bounds.position.x + bounds.size.x),
+                                   std::max(m_drawBounds.position.y + m_drawBounds.size.y, bounds.position.y + bounds.size.y));
+    m_drawBounds = sf::FloatRect(topLeft, bottomRight - topLeft);
+}
+
+void HUD::addPulseBorder(float x, float y, float width, float height, float thickness, const sf::Color& color) {
+    sf::RectangleShape border(sf::Vector2f(width, height));
+    border.setPosition(sf::Vector2f(x, y));
+    border.setFillColor(sf::Color::Transparent);
+    border.setOutlineThickness(thickness);
+    border.setOutlineColor(color);
+    m_overlay.submit(border, RenderLayer::Effects);
+}
+
+float HUD::cooldownFillWidth(float remaining, float max, float width) {
+    // Whole pixels, so a recharging bar only redraws when it visibly grows
+    float fraction = max > 0.f ? std::max(0.f, std::min(1.f, 1.f - (remaining / max))) : 1.f;
+    return std::floor(width * fraction);
 }
 
 void HUD::render(sf::RenderWindow& window, const Player* player, const Boss* boss) {
@@ -17,317 +125,378 @@ void HUD::render(sf::RenderWindow& window, const Player* player, const Boss* bos
     const float barWidth = 180.f;
     const float barHeight = 14.f;
     const float spacing = 22.f;
-    
+
+    // Without a cache everything, chrome included, goes straight to the window
+    sf::RenderTarget& target = m_cacheReady ? static_cast<sf::RenderTarget&>(m_cache) : window;
+    if (!m_cacheReady) {
+        drawChrome(window);
+    }
+
     // ===== LEFT PANEL: Player Abilities & Status =====
     {
         float x = padding;
         float y = padding;
-        
+
         // Player health bar
-        if (player) {
-            int health = player->getHealth();
-            int maxHealth = player->getMaxHealth();
-            drawHealthBar(window, x, y, barWidth, barHeight, health, maxHealth, 
-                         sf::Color(200, 50, 50), "HEALTH");
-            y += spacing + 8.f;
-        }
-        
-        // Parry cooldown
-        if (player) {
-            float remaining = player->getParryCooldown();
-            float max = player->getParryCooldownMax();
-            drawCooldownBar(window, x, y, barWidth, barHeight, remaining, max, 
-                           sf::Color(100, 180, 255), "PARRY");
-            y += spacing;
+        const WidgetInputs healthInputs = player
+            ? WidgetInputs{1, player->getHealth(), player->getMaxHealth(), 0}
+            : WidgetInputs{};
+        if (beginWidget(Widget::PlayerHealth, healthInputs)) {
+            if (player) {
+                drawHealthBar(target, x, y, barWidth, barHeight, player->getHealth(), player->getMaxHealth(),
+                             sf::Color(200, 50, 50), "HEALTH");
+            }
+            endWidget(Widget::PlayerHealth);
         }
-        
-        // Spirit Strike cooldown
         if (player) {
-            float remaining = player->getSpiritStrikeCooldown();
-            float max = player->getSpiritStrikeCooldownMax();
-            drawCooldownBar(window, x, y, barWidth, barHeight, remaining, max, 
-                           sf::Color(150, 150, 255), "SPIRIT");
-            y += spacing;
+            // Subtle flashing border when damaged
+            if (player->getHealth() < player->getMaxHealth()) {
+                float pulse = std::sin(std::clock() / 300000.f) * 0.5f + 0.5f;
+                sf::Color flashColor(200, 50, 50, static_cast<uint8_t>(100 * pulse));
+                addPulseBorder(x, y, barWidth, barHeight, 0.5f, flashColor);
+            }
+            y += spacing + 8.f;
         }
-        
-        // Echo Step cooldown
-        if (player) {
-            float remaining = player->getEchoStepCooldown();
-            float max = player->getEchoStepCooldownMax();
-            drawCooldownBar(window, x, y, barWidth, barHeight, remaining, max, 
-                           sf::Color(100, 255, 200), "ECHO");
-            y += spacing;
+
+        // Parry, Spirit Strike and Echo Step cooldowns
+        struct Cooldown {
+            Widget widget;
+            float remaining;
+            float max;
+            sf::Color color;
+            const char* label;
+        };
+        const std::array<Cooldown, 3> cooldowns = {{
+            {Widget::ParryCooldown, player ? player->getParryCooldown() : 0.f,
+             player ? player->getParryCooldownMax() : 0.f, sf::Color(100, 180, 255), "PARRY"},
+            {Widget::SpiritCooldown, player ? player->getSpiritStrikeCooldown() : 0.f,
+             player ? player->getSpiritStrikeCooldownMax() : 0.f, sf::Color(150, 150, 255), "SPIRIT"},
+            {Widget::EchoCooldown, player ? player->getEchoStepCooldown() : 0.f,
+             player ? player->getEchoStepCooldownMax() : 0.f, sf::Color(100, 255, 200), "ECHO"}
+        }};
+        for (const Cooldown& cooldown : cooldowns) {
+            const float fillWidth = cooldownFillWidth(cooldown.remaining, cooldown.max, barWidth);
+            const WidgetInputs inputs = player ? WidgetInputs{1, static_cast<int>(fillWidth), 0, 0} : WidgetInputs{};
+            if (beginWidget(cooldown.widget, inputs)) {
+                if (player) {
+                    drawCooldownBar(target, x, y, barWidth, barHeight, fillWidth, cooldown.color, cooldown.label);
+                }
+                endWidget(cooldown.widget);
+            }
+            if (player) {
+                // Ready indicator (glow when available)
+                if (fillWidth >= barWidth) {
+                    sf::Color glowColor = cooldown.color;
+                    float pulse = std::sin(std::clock() / 150000.f) * 0.3f + 0.7f;
+                    glowColor.a = static_cast<uint8_t>(180 * pulse);
+                    addPulseBorder(x, y, barWidth, barHeight, 2.f, glowColor);
+                }
+                y += spacing;
+            }
         }
     }
-    
+
     // ===== TOP CENTER: Boss Health =====
-    if (boss && boss->isActive()) {
+    {
         float bossBarWidth = 500.f;
         float bossBarHeight = 16.f;
         float ox = (static_cast<float>(m_windowWidth) - bossBarWidth) / 2.f;
         float oy = padding;
-        
-        int bossHealth = boss->getHealth();
-        int bossMaxHealth = boss->getMaxHealth();
-        drawHealthBar(window, ox, oy, bossBarWidth, bossBarHeight, bossHealth, bossMaxHealth,
-                     sf::Color(200, 80, 40), "BOSS");
+
+        const bool showBoss = boss && boss->isActive();
+        const WidgetInputs inputs = showBoss
+            ? WidgetInputs{1, boss->getHealth(), boss->getMaxHealth(), 0}
+            : WidgetInputs{};
+        if (beginWidget(Widget::BossHealth, inputs)) {
+            if (showBoss) {
+                drawHealthBar(target, ox, oy, bossBarWidth, bossBarHeight, boss->getHealth(), boss->getMaxHealth(),
+                             sf::Color(200, 80, 40), "BOSS");
+            }
+            endWidget(Widget::BossHealth);
+        }
+        if (showBoss && boss->getHealth() < boss->getMaxHealth()) {
+            float pulse = std::sin(std::clock() / 300000.f) * 0.5f + 0.5f;
+            sf::Color flashColor(200, 80, 40, static_cast<uint8_t>(100 * pulse));
+            addPulseBorder(ox, oy, bossBarWidth, bossBarHeight, 0.5f, flashColor);
+        }
     }
-    
+
     // ===== CENTER: Combo Counter =====
-    if (player && player->getComboCount() > 0) {
-        float comboSize = 60.f + (player->getComboCount() * 20.f);  // Scale with combo
+    {
+        const int comboCount = player ? player->getComboCount() : 0;
+        float comboSize = 60.f + (comboCount * 20.f);  // Scale with combo
         float comboX = (static_cast<float>(m_windowWidth) - comboSize) / 2.f;
         float comboY = static_cast<float>(m_windowHeight) / 2.f - 100.f;
-        
-        // Combo number display
-        sf::CircleShape comboCircle(comboSize / 2.f);
-        comboCircle.setPosition(sf::Vector2f(comboX, comboY));
-        
-        // Color based on combo count
-        sf::Color comboColor;
-        switch (player->getComboCount()) {
-            case 1: comboColor = sf::Color(255, 200, 100, 200); break;
-            case 2: comboColor = sf::Color(255, 150, 50, 220); break;
-            case 3: comboColor = sf::Color(255, 50, 50, 255); break;  // Finisher!
-            default: comboColor = sf::Color(255, 255, 255, 200); break;
-        }
-        comboCircle.setFillColor(comboColor);
-        comboCircle.setOutlineThickness(3.f);
-        comboCircle.setOutlineColor(sf::Color(255, 255, 255, 180));
-        window.draw(comboCircle);
-        
-        // Draw small dots to represent combo count visually
-        int comboCount = player->getComboCount();
-        for (int i = 0; i < comboCount && i < 3; ++i) {
-            float dotSize = 8.f;
-            float dotSpacing = 18.f;
-            float dotX = comboX + comboSize / 2.f - ((comboCount - 1) * dotSpacing) / 2.f + i * dotSpacing;
-            float dotY = comboY + comboSize / 2.f - dotSize / 2.f;
-            
-            sf::CircleShape dot(dotSize);
-            dot.setPosition(sf::Vector2f(dotX - dotSize, dotY));
-            dot.setFillColor(sf::Color(255, 255, 255));
-            dot.setOutlineThickness(1.f);
-            dot.setOutlineColor(sf::Color(200, 200, 200));
-            window.draw(dot);
+
+        if (beginWidget(Widget::Combo, WidgetInputs{comboCount, 0, 0, 0})) {
+            if (comboCount > 0) {
+                // Combo number display
+                sf::CircleShape comboCircle(comboSize / 2.f);
+                comboCircle.setPosition(sf::Vector2f(comboX, comboY));
+
+                // Color based on combo count
+                sf::Color comboColor;
+                switch (comboCount) {
+                    case 1: comboColor = sf::Color(255, 200, 100, 200); break;
+                    case 2: comboColor = sf::Color(255, 150, 50, 220); break;
+                    case 3: comboColor = sf::Color(255, 50, 50, 255); break;  // Finisher!
+                    default: comboColor = sf::Color(255, 255, 255, 200); break;
+                }
+                comboCircle.setFillColor(comboColor);
+                comboCircle.setOutlineThickness(3.f);
+                comboCircle.setOutlineColor(sf::Color(255, 255, 255, 180));
+                drawShape(target, comboCircle);
+
+                // Draw small dots to represent combo count visually
+                for (int i = 0; i < comboCount && i < 3; ++i) {
+                    float dotSize = 8.f;
+                    float dotSpacing = 18.f;
+                    float dotX = comboX + comboSize / 2.f - ((comboCount - 1) * dotSpacing) / 2.f + i * dotSpacing;
+                    float dotY = comboY + comboSize / 2.f - dotSize / 2.f;
+
+                    sf::CircleShape dot(dotSize);
+                    dot.setPosition(sf::Vector2f(dotX - dotSize, dotY));
+                    dot.setFillColor(sf::Color(255, 255, 255));
+                    dot.setOutlineThickness(1.f);
+                    dot.setOutlineColor(sf::Color(200, 200, 200));
+                    drawShape(target, dot);
+                }
+            }
+            endWidget(Widget::Combo);
         }
-        
-        // Combo timer indicator (ring around circle)
-        float timerFraction = player->getComboTimer() / 0.8f;  // COMBO_WINDOW
-        if (timerFraction > 0.f) {
-            sf::CircleShape timerRing(comboSize / 2.f + 5.f);
-            timerRing.setPosition(sf::Vector2f(comboX - 5.f, comboY - 5.f));
-            timerRing.setFillColor(sf::Color::Transparent);
-            timerRing.setOutlineThickness(2.f);
-            sf::Color ringColor = sf::Color(100, 255, 100);
-            ringColor.a = static_cast<uint8_t>(255 * timerFraction);
-            timerRing.setOutlineColor(ringColor);
-            window.draw(timerRing);
+
+        // Combo timer indicator (ring around circle), fades every frame
+        if (comboCount > 0) {
+            float timerFraction = player->getComboTimer() / 0.8f;  // COMBO_WINDOW
+            if (timerFraction > 0.f) {
+                sf::CircleShape timerRing(comboSize / 2.f + 5.f);
+                timerRing.setPosition(sf::Vector2f(comboX - 5.f, comboY - 5.f));
+                timerRing.setFillColor(sf::Color::Transparent);
+                timerRing.setOutlineThickness(2.f);
+                sf::Color ringColor = sf::Color(100, 255, 100);
+                ringColor.a = static_cast<uint8_t>(255 * timerFraction);
+                timerRing.setOutlineColor(ringColor);
+                m_overlay.submit(timerRing, RenderLayer::Effects);
+            }
         }
     }
-    
+
     // ===== CENTER BOTTOM: Heavy Charge Indicator =====
-    if (player && player->isChargingHeavy()) {
-        float chargeLevel = player->getHeavyChargeLevel();
+    {
+        const bool charging = player && player->isChargingHeavy();
+        float chargeLevel = charging ? player->getHeavyChargeLevel() : 0.f;
         float barWidth = 200.f;
         float barHeight = 20.f;
         float chargeX = (static_cast<float>(m_windowWidth) - barWidth) / 2.f;
         float chargeY = static_cast<float>(m_windowHeight) - 100.f;
-        
-        // Background
-        sf::RectangleShape chargeBg(sf::Vector2f(barWidth, barHeight));
-        chargeBg.setPosition(sf::Vector2f(chargeX, chargeY));
-        chargeBg.setFillColor(sf::Color(40, 40, 40));
-        chargeBg.setOutlineThickness(2.f);
-        chargeBg.setOutlineColor(sf::Color(100, 100, 100));
-        window.draw(chargeBg);
-        
-        // Charge fill
-        sf::RectangleShape chargeFill(sf::Vector2f(barWidth * chargeLevel, barHeight));
-        chargeFill.setPosition(sf::Vector2f(chargeX, chargeY));
-        
+        const float fillWidth = std::floor(barWidth * chargeLevel);
+
         // Color changes as it charges
-        if (chargeLevel >= 1.0f) {
-            chargeFill.setFillColor(sf::Color(255, 255, 0));  // Max charge - yellow
-            
-            // Pulsing glow effect when fully charged
+        const int tier = chargeLevel >= 1.0f ? 2 : (chargeLevel >= 0.5f ? 1 : 0);
+        const WidgetInputs inputs = charging ? WidgetInputs{1, static_cast<int>(fillWidth), tier, 0} : WidgetInputs{};
+        if (beginWidget(Widget::HeavyCharge, inputs)) {
+            if (charging) {
+                // Background
+                sf::RectangleShape chargeBg(sf::Vector2f(barWidth, barHeight));
+                chargeBg.setPosition(sf::Vector2f(chargeX, chargeY));
+                chargeBg.setFillColor(sf::Color(40, 40, 40));
+                chargeBg.setOutlineThickness(2.f);
+                chargeBg.setOutlineColor(sf::Color(100, 100, 100));
+                drawShape(target, chargeBg);
+
+                // Charge fill
+                sf::RectangleShape chargeFill(sf::Vector2f(fillWidth, barHeight));
+                chargeFill.setPosition(sf::Vector2f(chargeX, chargeY));
+                switch (tier) {
+                    case 2: chargeFill.setFillColor(sf::Color(255, 255, 0)); break;  // Max charge - yellow
+                    case 1: chargeFill.setFillColor(sf::Color(255, 150, 50)); break;  // Mid charge - orange
+                    default: chargeFill.setFillColor(sf::Color(255, 100, 100)); break;  // Starting - red
+                }
+                drawShape(target, chargeFill);
+            }
+            endWidget(Widget::HeavyCharge);
+        }
+
+        // Pulsing glow effect when fully charged
+        if (charging && tier == 2) {
             float pulse = std::sin(std::clock() / 100000.f) * 0.4f + 0.6f;
-            sf::RectangleShape chargeGlow(sf::Vector2f(barWidth, barHeight));
-            chargeGlow.setPosition(sf::Vector2f(chargeX, chargeY));
-            chargeGlow.setFillColor(sf::Color::Transparent);
-            chargeGlow.setOutlineThickness(3.f);
             sf::Color glowColor = sf::Color(255, 255, 100);
             glowColor.a = static_cast<uint8_t>(200 * pulse);
-            chargeGlow.setOutlineColor(glowColor);
-            window.draw(chargeGlow);
-        } else if (chargeLevel >= 0.5f) {
-            chargeFill.setFillColor(sf::Color(255, 150, 50));  // Mid charge - orange
-        } else {
-            chargeFill.setFillColor(sf::Color(255, 100, 100));  // Starting - red
+            addPulseBorder(chargeX, chargeY, barWidth, barHeight, 3.f, glowColor);
         }
-        window.draw(chargeFill);
     }
-    
+
     // ===== RIGHT PANEL: Status Effects & Info =====
     {
-        float x = m_windowWidth - padding - 160.f;
-        float y = padding;
-        
-        // Draw status indicators
+        // One bit per indicator, so the stack only redraws when one toggles
+        int flags = 0;
         if (player) {
-            // Wall slide indicator
-            if (player->isWallSliding()) {
+            flags |= player->isWallSliding() ? 1 : 0;
+            flags |= player->isOnLedge() ? 2 : 0;
+            flags |= player->isParrying() ? 4 : 0;
+            flags |= player->isSpiritStrikeActive() ? 8 : 0;
+        }
+
+        if (beginWidget(Widget::Status, WidgetInputs{flags, 0, 0, 0})) {
+            float x = m_windowWidth - padding - 160.f;
+            float y = padding;
+
+            auto drawIndicator = [&](const sf::Color& fill, float thickness, const sf::Color& outline) {
                 sf::RectangleShape indicator(sf::Vector2f(140.f, 14.f));
-                indicator.setFillColor(sf::Color(100, 150, 255, 150));
-                indicator.setOutlineThickness(1.f);
-                indicator.setOutlineColor(sf::Color(150, 200, 255));
+                indicator.setFillColor(fill);
+                indicator.setOutlineThickness(thickness);
+                indicator.setOutlineColor(outline);
                 indicator.setPosition(sf::Vector2f(x + 10.f, y));
-                window.draw(indicator);
+                drawShape(target, indicator);
                 y += spacing;
+            };
+
+            // Wall slide indicator
+            if (flags & 1) {
+                drawIndicator(sf::Color(100, 150, 255, 150), 1.f, sf::Color(150, 200, 255));
             }
-            
+
             // Ledge grab indicator
-            if (player->isOnLedge()) {
-                sf::RectangleShape indicator(sf::Vector2f(140.f, 14.f));
-                indicator.setFillColor(sf::Color(200, 180, 100, 150));
-                indicator.setOutlineThickness(1.f);
-                indicator.setOutlineColor(sf::Color(220, 200, 150));
-                indicator.setPosition(sf::Vector2f(x + 10.f, y));
-                window.draw(indicator);
-                y += spacing;
+            if (flags & 2) {
+                drawIndicator(sf::Color(200, 180, 100, 150), 1.f, sf::Color(220, 200, 150));
             }
-            
+
             // Parry active indicator
-            if (player->isParrying()) {
-                sf::RectangleShape indicator(sf::Vector2f(140.f, 14.f));
-                indicator.setFillColor(sf::Color(100, 200, 255, 200));
-                indicator.setOutlineThickness(2.f);
-                indicator.setOutlineColor(sf::Color(200, 255, 255));
-                indicator.setPosition(sf::Vector2f(x + 10.f, y));
-                window.draw(indicator);
-                y += spacing;
+            if (flags & 4) {
+                drawIndicator(sf::Color(100, 200, 255, 200), 2.f, sf::Color(200, 255, 255));
             }
-            
+
             // Spirit Strike active indicator
-            if (player->isSpiritStrikeActive()) {
-                sf::RectangleShape indicator(sf::Vector2f(140.f, 14.f));
-                indicator.setFillColor(sf::Color(150, 150, 255, 200));
-                indicator.setOutlineThickness(2.f);
-                indicator.setOutlineColor(sf::Color(200, 200, 255));
-                indicator.setPosition(sf::Vector2f(x + 10.f, y));
-                window.draw(indicator);
-                y += spacing;
+            if (flags & 8) {
+                drawIndicator(sf::Color(150, 150, 255, 200), 2.f, sf::Color(200, 200, 255));
             }
+            endWidget(Widget::Status);
         }
     }
-    
-    // ===== BOTTOM CENTER: Debug Info =====
-    #ifdef _DEBUG
+
+    // ===== BOTTOM LEFT: Render Cost =====
     {
-        float debugX = m_windowWidth / 2.f - 100.f;
-        float debugY = m_windowHeight - 60.f;
-        
-        // Draw semi-transparent debug background
-        sf::RectangleShape debugBg(sf::Vector2f(200.f, 50.f));
-        debugBg.setFillColor(sf::Color(0, 0, 0, 100));
-        debugBg.setOutlineThickness(1.f);
-        debugBg.setOutlineColor(sf::Color(100, 100, 100));
-        debugBg.setPosition(sf::Vector2f(debugX, debugY));
-        window.draw(debugBg);
+        const WidgetInputs inputs = m_showRenderStats
+            ? WidgetInputs{1, static_cast<int>(m_cullStats.drawn), static_cast<int>(m_cullStats.culled),
+                           static_cast<int>(m_drawCalls)}
+            : WidgetInputs{};
+        if (beginWidget(Widget::RenderStats, inputs)) {
+            if (m_showRenderStats) {
+                const float panelX = padding;
+                const float panelY = static_cast<float>(m_windowHeight) - padding - 50.f;
+                const float statsBarWidth = 180.f;
+
+                sf::RectangleShape panel(sf::Vector2f(200.f, 50.f));
+                panel.setFillColor(sf::Color(0, 0, 0, 100));
+                panel.setOutlineThickness(1.f);
+                panel.setOutlineColor(sf::Color(100, 100, 100));
+                panel.setPosition(sf::Vector2f(panelX, panelY));
+                drawShape(target, panel);
+
+                // Drawn (green) and culled (grey) world objects as shares of one bar
+                const std::size_t tested = m_cullStats.drawn + m_cullStats.culled;
+                const float drawnWidth = tested > 0
+                    ? std::floor(statsBarWidth * static_cast<float>(m_cullStats.drawn) / static_cast<float>(tested))
+                    : 0.f;
+                sf::RectangleShape culledBar(sf::Vector2f(statsBarWidth, barHeight));
+                culledBar.setFillColor(sf::Color(90, 90, 90));
+                culledBar.setPosition(sf::Vector2f(panelX + 10.f, panelY + 6.f));
+                drawShape(target, culledBar);
+                sf::RectangleShape drawnBar(sf::Vector2f(drawnWidth, barHeight));
+                drawnBar.setFillColor(sf::Color(100, 220, 120));
+                drawnBar.setPosition(sf::Vector2f(panelX + 10.f, panelY + 6.f));
+                drawShape(target, drawnBar);
+
+                // Draw calls, a few pixels each so single calls are visible
+                const float callsWidth = std::min(statsBarWidth, static_cast<float>(m_drawCalls) * 6.f);
+                sf::RectangleShape callsBar(sf::Vector2f(callsWidth, barHeight));
+                callsBar.setFillColor(sf::Color(100, 160, 255));
+                callsBar.setPosition(sf::Vector2f(panelX + 10.f, panelY + 28.f));
+                drawShape(target, callsBar);
+
+                drawText(target, "DRAWN " + std::to_string(m_cullStats.drawn) + " / CULLED "
+                         + std::to_string(m_cullStats.culled), panelX + 10.f, panelY + 6.f, 10, sf::Color::White);
+                drawText(target, "DRAW CALLS " + std::to_string(m_drawCalls),
+                         panelX + 10.f, panelY + 28.f, 10, sf::Color::White);
+            }
+            endWidget(Widget::RenderStats);
+        }
     }
-    #endif
+
+    // One quad for every retained widget, then one batch for the pulses
+    if (m_cacheReady) {
+        if (m_cacheDirty) {
+            m_cache.display();
+            m_cacheDirty = false;
+        }
+        sf::Sprite cached(m_cache.getTexture());
+        window.draw(cached, sf::RenderStates(BLEND_PREMULTIPLIED));
+    }
+    m_overlay.flush(window);
 }
 
-void HUD::drawCooldownBar(sf::RenderWindow& window, float x, float y, float width, float height,
-                         float remaining, float max, const sf::Color& color, const std::string& label) {
+void HUD::drawCooldownBar(sf::RenderTarget& target, float x, float y, float width, float height,
+                         float fillWidth, const sf::Color& color, const std::string& label) {
     (void)label;
-    
+
     // Ability icon (small colored circle)
     sf::CircleShape icon(height / 2.f);
     icon.setPosition(sf::Vector2f(x - height - 5.f, y));
     icon.setFillColor(color);
     icon.setOutlineThickness(1.f);
     icon.setOutlineColor(sf::Color(200, 200, 200));
-    window.draw(icon);
-    
+    drawShape(target, icon);
+
     // Background
     sf::RectangleShape background(sf::Vector2f(width, height));
     background.setFillColor(sf::Color(40, 40, 40));
     background.setPosition(sf::Vector2f(x, y));
-    window.draw(background);
-    
+    drawShape(target, background);
+
     // Filled portion
-    float fraction = max > 0.f ? std::max(0.f, std::min(1.f, 1.f - (remaining / max))) : 1.f;
-    sf::RectangleShape fill(sf::Vector2f(width * fraction, height));
+    sf::RectangleShape fill(sf::Vector2f(fillWidth, height));
     fill.setFillColor(color);
     fill.setPosition(sf::Vector2f(x, y));
-    window.draw(fill);
-    
+    drawShape(target, fill);
+
     // Border
     sf::RectangleShape border(sf::Vector2f(width, height));
     border.setFillColor(sf::Color::Transparent);
     border.setOutlineThickness(1.f);
     border.setOutlineColor(sf::Color(100, 100, 100));
     border.setPosition(sf::Vector2f(x, y));
-    window.draw(border);
-    
-    // Ready indicator (glow when available)
-    if (fraction >= 1.f) {
-        sf::RectangleShape readyGlow(sf::Vector2f(width, height));
-        readyGlow.setPosition(sf::Vector2f(x, y));
-        readyGlow.setFillColor(sf::Color::Transparent);
-        readyGlow.setOutlineThickness(2.f);
-        sf::Color glowColor = color;
-        float pulse = std::sin(std::clock() / 150000.f) * 0.3f + 0.7f;
-        glowColor.a = static_cast<uint8_t>(180 * pulse);
-        readyGlow.setOutlineColor(glowColor);
-        window.draw(readyGlow);
-    }
+    drawShape(target, border);
 }
 
-void HUD::drawHealthBar(sf::RenderWindow& window, float x, float y, float width, float height,
+void HUD::drawHealthBar(sf::RenderTarget& target, float x, float y, float width, float height,
                        int current, int max, const sf::Color& color, const std::string& label) {
     (void)label;
     // Background
     sf::RectangleShape background(sf::Vector2f(width, height));
     background.setFillColor(sf::Color(40, 40, 40));
     background.setPosition(sf::Vector2f(x, y));
-    window.draw(background);
-    
+    drawShape(target, background);
+
     // Filled portion
     float fraction = max > 0 ? static_cast<float>(current) / static_cast<float>(max) : 0.f;
     fraction = std::max(0.f, std::min(1.f, fraction));
     sf::RectangleShape fill(sf::Vector2f(width * fraction, height));
     fill.setFillColor(color);
     fill.setPosition(sf::Vector2f(x, y));
-    window.draw(fill);
-    
+    drawShape(target, fill);
+
     // Border
     sf::RectangleShape border(sf::Vector2f(width, height));
     border.setFillColor(sf::Color::Transparent);
     border.setOutlineThickness(1.5f);
     border.setOutlineColor(color);
     border.setPosition(sf::Vector2f(x, y));
-    window.draw(border);
-    
-    // Damage flash effect (optional pulse)
-    if (current < max) {
-        // Subtle flashing border when damaged
-        float pulse = std::sin(std::clock() / 300000.f) * 0.5f + 0.5f;
-        sf::RectangleShape flashBorder(sf::Vector2f(width, height));
-        flashBorder.setFillColor(sf::Color::Transparent);
-        flashBorder.setOutlineThickness(0.5f);
-        sf::Color flashColor = color;
-        flashColor.a = static_cast<uint8_t>(100 * pulse);
-        flashBorder.setOutlineColor(flashColor);
-        flashBorder.setPosition(sf::Vector2f(x, y));
-        window.draw(flashBorder);
-    }
+    drawShape(target, border);
 }
 
-void HUD::drawText(sf::RenderWindow& window, const std::string& text, float x, float y,
+void HUD::drawText(sf::RenderTarget& target, const std::string& text, float x, float y,
                   unsigned int size, const sf::Color& color) {
-    (void)window;
+    (void)target;
     (void)text;
     (void)x;
     (void)y;
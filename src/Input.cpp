@@ -0,0 +1,46 @@
+#include "Input.hpp"
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Joystick.hpp>
+#include <cmath>
+
+InputState InputState::poll() {
+    using Key = sf::Keyboard::Key;
+    InputState input;
+    
+    // Horizontal movement
+    if (sf::Keyboard::isKeyPressed(Key::A) || sf::Keyboard::isKeyPressed(Key::Left)) {
+        input.moveX = -1.f;
+    }
+    else if (sf::Keyboard::isKeyPressed(Key::D) || sf::Keyboard::isKeyPressed(Key::Right)) {
+        input.moveX = 1.f;
+    }
+    
+    input.up = sf::Keyboard::isKeyPressed(Key::W) || sf::Keyboard::isKeyPressed(Key::Up);
+    input.down = sf::Keyboard::isKeyPressed(Key::S) || sf::Keyboard::isKeyPressed(Key::Down);
+    input.jump = sf::Keyboard::isKeyPressed(Key::Space) || input.up;
+    input.lightAttack = sf::Keyboard::isKeyPressed(Key::J);
+    input.heavyAttack = sf::Keyboard::isKeyPressed(Key::K);
+    input.parry = sf::Keyboard::isKeyPressed(Key::P);
+    input.spiritStrike = sf::Keyboard::isKeyPressed(Key::Q);
+    input.echoStep = sf::Keyboard::isKeyPressed(Key::E);
+    
+    // Controller overrides/adds to the keyboard
+    if (sf::Joystick::isConnected(0)) {
+        float axisX = sf::Joystick::getAxisPosition(0, sf::Joystick::Axis::X);
+        if (std::abs(axisX) > 30.f) {
+            input.moveX = (axisX > 0.f) ? 1.f : -1.f;
+        }
+        float axisY = sf::Joystick::getAxisPosition(0, sf::Joystick::Axis::Y);
+        if (axisY < -30.f) input.up = true;
+        if (axisY > 30.f) input.down = true;
+        
+        input.jump = input.jump || sf::Joystick::isButtonPressed(0, 0);
+        input.parry = input.parry || sf::Joystick::isButtonPressed(0, 1);
+        input.lightAttack = input.lightAttack || sf::Joystick::isButtonPressed(0, 2);
+        input.heavyAttack = input.heavyAttack || sf::Joystick::isButtonPressed(0, 3);
+        input.spiritStrike = input.spiritStrike || sf::Joystick::isButtonPressed(0, 4);
+        input.echoStep = input.echoStep || sf::Joystick::isButtonPressed(0, 5);
+    }
+    
+    return input;
+}
@@ -0,0 +1,33 @@
+#include "IntentBuffer.hpp"
+#include "ProjectileSystem.hpp"
+
+void IntentBuffer::recordParticle(ParticleLayer layer, const sf::Vector2f& position, const sf::Vector2f& velocity,
+                                  const sf::Color& color, float lifetime, float size, ParticleShape shape,
+                                  bool glow, float rotationSpeed, bool trail) {
+    m_particles.push_back(ParticleIntent{layer, position, velocity, color, lifetime, size,
+                                         shape, glow, rotationSpeed, trail});
+}
+
+void IntentBuffer::recordProjectile(ProjectileSystem& target, const sf::Vector2f& position,
+                                    const sf::Vector2f& velocity, int damage, const sf::Color& color,
+                                    const Entity* owner) {
+    m_projectiles.push_back(ProjectileIntent{&target, position, velocity, damage, color, owner});
+}
+
+void IntentBuffer::commit() {
+    ParticleWorld& particles = ParticleWorld::getInstance();
+    for (const ParticleIntent& intent : m_particles) {
+        particles.spawn(intent.layer, intent.position, intent.velocity, intent.color, intent.lifetime,
+                        intent.size, intent.shape, intent.glow, intent.rotationSpeed, intent.trail);
+    }
+    for (const ProjectileIntent& intent : m_projectiles) {
+        intent.target->spawn(intent.position, intent.velocity, intent.damage, intent.color, intent.owner);
+    }
+    clear();
+}
+
+void IntentBuffer::clear() {
+    // Keep the capacity, the same buffers are refilled every tick
+    m_particles.clear();
+    m_projectiles.clear();
+}
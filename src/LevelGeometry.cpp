@@ -0,0 +1,50 @@
+#include "LevelGeometry.hpp"
+#include <iostream>
+#include <utility>
+
+LevelGeometry::LevelGeometry()
+    : m_buffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static)
+    , m_vertexCount(0)
+    , m_platformCount(0)
+    , m_revision(0)
+    , m_built(false)
+{
+}
+
+void LevelGeometry::build(const std::vector<Platform>& platforms, std::uint32_t levelRevision) {
+    std::vector<sf::Vertex> vertices;
+    vertices.reserve(platforms.size() * Platform::VERTEX_COUNT);
+    m_platformCount = 0;
+    for (const auto& platform : platforms) {
+        if (platform.isMoving()) continue;
+
+        vertices.resize(vertices.size() + Platform::VERTEX_COUNT);
+        platform.writeVertices(vertices.data() + vertices.size() - Platform::VERTEX_COUNT);
+        ++m_platformCount;
+    }
+
+    m_vertexCount = vertices.size();
+    m_revision = levelRevision;
+    m_built = true;
+    m_fallback.clear();
+    if (m_vertexCount == 0) return;
+
+    // Upload once; a static buffer lives in GPU memory until the level changes
+    if (sf::VertexBuffer::isAvailable()) {
+        if (m_buffer.getVertexCount() == m_vertexCount || m_buffer.create(m_vertexCount)) {
+            if (m_buffer.update(vertices.data())) return;
+        }
+        std::cerr << "Failed to upload level geometry, drawing from client memory" << std::endl;
+    }
+    m_fallback = std::move(vertices);
+}
+
+void LevelGeometry::render(sf::RenderTarget& target) const {
+    if (m_vertexCount == 0) return;
+
+    if (!m_fallback.empty()) {
+        target.draw(m_fallback.data(), m_fallback.size(), sf::PrimitiveType::Triangles);
+    } else {
+        target.draw(m_buffer);
+    }
+}
@@ -0,0 +1,144 @@
+#include "ParticleEmitter.hpp"
+#include "IntentBuffer.hpp"
+#include <cmath>
+#include <algorithm>
+
+ParticleEmitter::ParticleEmitter(ParticleLayer layer)
+    : m_layer(layer)
+    , m_trailsEnabled(true)
+    , m_random(ParticleWorld::getInstance().nextEmitterSeed())
+    , m_quality(ParticleQuality::High)
+    , m_qualityScale(1.0f)
+    , m_intents(nullptr) {
+}
+
+void ParticleEmitter::setQuality(ParticleQuality quality) {
+    m_quality = quality;
+    switch (quality) {
+        case ParticleQuality::Low: m_qualityScale = 0.5f; break;
+        case ParticleQuality::Medium: m_qualityScale = 0.75f; break;
+        case ParticleQuality::High: m_qualityScale = 1.0f; break;
+    }
+}
+
+int ParticleEmitter::scaleCount(int count) const {
+    return static_cast<int>(std::ceil(count * m_qualityScale));
+}
+
+void ParticleEmitter::spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, const sf::Color& color,
+                            float lifetime, float size, ParticleShape shape, bool glow, float rotationSpeed) {
+    if (m_intents) {
+        m_intents->recordParticle(m_layer, position, velocity, color, lifetime, size,
+                                  shape, glow, rotationSpeed, m_trailsEnabled);
+        return;
+    }
+    ParticleWorld::getInstance().spawn(m_layer, position, velocity, color, lifetime, size,
+                                       shape, glow, rotationSpeed, m_trailsEnabled);
+}
+
+void ParticleEmitter::emitRadial(const sf::Vector2f& position, int count, const sf::Color& color,
+                                 const RadialParams& params) {
+    float speeds[EMIT_BATCH];
+    float lifetimes[EMIT_BATCH];
+    float sizes[EMIT_BATCH];
+    float rotations[EMIT_BATCH] = {};
+
+    for (int base = 0; base < count; base += EMIT_BATCH) {
+        const std::size_t batch = static_cast<std::size_t>(std::min(EMIT_BATCH, count - base));
+        m_random.fill(speeds, batch, params.minSpeed, params.maxSpeed);
+        m_random.fill(lifetimes, batch, params.minLifetime, params.maxLifetime);
+        m_random.fill(sizes, batch, params.minSize, params.maxSize);
+        if (params.maxRotationSpeed != 0.f) {
+            m_random.fill(rotations, batch, -params.maxRotationSpeed, params.maxRotationSpeed);
+        }
+
+        for (std::size_t i = 0; i < batch; ++i) {
+            sf::Vector2f vel = m_random.unitDirection() * speeds[i];
+            spawn(position, vel, color, lifetimes[i], sizes[i], params.shape, params.glow, rotations[i]);
+        }
+    }
+}
+
+void ParticleEmitter::emit(const sf::Vector2f& position, int count, const sf::Color& color,
+                          float speed, float lifetime, float size) {
+    RadialParams params{speed * 0.5f, speed, lifetime * 0.8f, lifetime * 1.2f, size * 0.7f, size * 1.3f};
+    emitRadial(position, std::max(1, scaleCount(count)), color, params);
+}
+
+void ParticleEmitter::emitBurst(const sf::Vector2f& position, int count, const sf::Color& color,
+                               float minSpeed, float maxSpeed, float lifetime, float size) {
+    RadialParams params{minSpeed, maxSpeed, lifetime * 0.8f, lifetime * 1.2f, size * 0.7f, size * 1.3f};
+    emitRadial(position, std::max(1, scaleCount(count)), color, params);
+}
+
+void ParticleEmitter::emitDirectional(const sf::Vector2f& position, const sf::Vector2f& direction,
+                                    int count, const sf::Color& color, float spread,
+                                    float speed, float lifetime, float size) {
+    float baseAngle = std::atan2(direction.y, direction.x);
+    float spreadRad = spread * 3.14159f / 180.f;
+    int actualCount = std::max(1, scaleCount(count));
+    
+    for (int i = 0; i < actualCount; ++i) {
+        float angle = baseAngle + m_random.range(-spreadRad, spreadRad);
+        sf::Vector2f dir(std::cos(angle), std::sin(angle));
+        sf::Vector2f vel = dir * m_random.range(speed * 0.7f, speed * 1.3f);
+        float life = m_random.range(lifetime * 0.8f, lifetime * 1.2f);
+        float particleSize = m_random.range(size * 0.7f, size * 1.3f);
+        
+        spawn(position, vel, color, life, particleSize);
+    }
+}
+
+// New enhanced particle emitters
+void ParticleEmitter::emitSparks(const sf::Vector2f& position, int count, const sf::Color& color,
+                                float speed, float lifetime) {
+    RadialParams params{speed * 0.8f, speed * 1.5f, lifetime * 0.7f, lifetime * 1.3f, 3.f, 6.f,
+                        ParticleShape::Spark, false, 360.f};
+    emitRadial(position, std::max(1, scaleCount(count)), color, params);
+}
+
+void ParticleEmitter::emitGlow(const sf::Vector2f& position, int count, const sf::Color& color,
+                              float speed, float lifetime, float size) {
+    RadialParams params{speed * 0.5f, speed, lifetime * 0.8f, lifetime * 1.2f, size * 0.8f, size * 1.2f,
+                        ParticleShape::Circle, true};
+    emitRadial(position, std::max(1, scaleCount(count)), color, params);
+}
+
+void ParticleEmitter::emitExplosion(const sf::Vector2f& position, const sf::Color& color,
+                                  int ringCount, int particlesPerRing) {
+    int actualRings = std::max(1, scaleCount(ringCount));
+    int actualPerRing = std::max(1, scaleCount(particlesPerRing));
+    for (int ring = 0; ring < actualRings; ++ring) {
+        float ringSpeed = 150.f + (ring * 80.f);
+        float ringDelay = ring * 0.05f;
+        
+        for (int i = 0; i < actualPerRing; ++i) {
+            float angle = (static_cast<float>(i) / particlesPerRing) * 6.28318f;
+            sf::Vector2f dir(std::cos(angle), std::sin(angle));
+            sf::Vector2f vel = dir * ringSpeed;
+            
+            ParticleShape shape = (ring % 2 == 0) ? ParticleShape::Star : ParticleShape::Circle;
+            float particleSize = m_random.range(4.f, 7.f);
+            float rotationSpeed = m_random.range(-540.f, 540.f);
+            spawn(position, vel, color, 0.6f - ringDelay, particleSize, shape, true, rotationSpeed);
+        }
+    }
+}
+
+void ParticleEmitter::emitTrail(const sf::Vector2f& position, const sf::Color& color,
+                              int count, float size) {
+    RadialParams params{20.f, 50.f, 0.2f, 0.4f, size * 0.5f, size, ParticleShape::Circle, true};
+    emitRadial(position, std::max(1, scaleCount(count)), color, params);
+}
+
+void ParticleEmitter::emitRing(const sf::Vector2f& position, const sf::Color& color,
+                             float radius, int segments) {
+    int actualSegments = std::max(1, scaleCount(segments));
+    for (int i = 0; i < actualSegments; ++i) {
+        float angle = (static_cast<float>(i) / segments) * 6.28318f;
+        sf::Vector2f offset(std::cos(angle) * radius, std::sin(angle) * radius);
+        sf::Vector2f vel(0.f, 0.f);  // Static ring particles
+        
+        spawn(position + offset, vel, color, 0.5f, 5.f, ParticleShape::Ring, false);
+    }
+}
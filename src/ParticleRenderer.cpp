@@ -0,0 +1,210 @@
+#include "ParticleRenderer.hpp"
+#include <array>
+#include <cmath>
+
+namespace {
+    constexpr float PI = 3.14159265f;
+
+    // Points on a unit circle, starting at the top like sf::CircleShape
+    template <std::size_t N>
+    std::array<sf::Vector2f, N> makeUnitPolygon() {
+        std::array<sf::Vector2f, N> points;
+        for (std::size_t i = 0; i < N; ++i) {
+            float angle = static_cast<float>(i) * 2.f * PI / static_cast<float>(N) - PI / 2.f;
+            points[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+        }
+        return points;
+    }
+
+    const std::array<sf::Vector2f, ParticleRenderer::CIRCLE_SEGMENTS> UNIT_CIRCLE =
+        makeUnitPolygon<ParticleRenderer::CIRCLE_SEGMENTS>();
+    const std::array<sf::Vector2f, ParticleRenderer::STAR_POINTS> UNIT_STAR =
+        makeUnitPolygon<ParticleRenderer::STAR_POINTS>();
+
+    constexpr std::size_t fanVertexCount(std::size_t points) {
+        return (points - 2) * 3;
+    }
+
+    // Emit a convex polygon as a triangle fan anchored on its first point
+    template <std::size_t N>
+    sf::Vertex* writeFan(sf::Vertex* out, const std::array<sf::Vector2f, N>& unit,
+                         const sf::Vector2f& center, float radius,
+                         float cosA, float sinA, const sf::Color& color) {
+        auto point = [&](std::size_t i) {
+            const sf::Vector2f& p = unit[i];
+            return center + sf::Vector2f(p.x * cosA - p.y * sinA, p.x * sinA + p.y * cosA) * radius;
+        };
+        const sf::Vector2f first = point(0);
+        sf::Vector2f previous = point(1);
+        for (std::size_t i = 2; i < N; ++i) {
+            sf::Vector2f current = point(i);
+            *out++ = sf::Vertex{first, color};
+            *out++ = sf::Vertex{previous, color};
+            *out++ = sf::Vertex{current, color};
+            previous = current;
+        }
+        return out;
+    }
+
+    // Emit an oriented rectangle centred on `center` with half extents along `axis`
+    sf::Vertex* writeQuad(sf::Vertex* out, const sf::Vector2f& center, const sf::Vector2f& axis,
+                          float halfLength, float halfWidth, const sf::Color& color) {
+        const sf::Vector2f along = axis * halfLength;
+        const sf::Vector2f across = sf::Vector2f(-axis.y, axis.x) * halfWidth;
+        const sf::Vector2f a = center - along - across;
+        const sf::Vector2f b = center + along - across;
+        const sf::Vector2f c = center + along + across;
+        const sf::Vector2f d = center - along + across;
+        *out++ = sf::Vertex{a, color};
+        *out++ = sf::Vertex{b, color};
+        *out++ = sf::Vertex{c, color};
+        *out++ = sf::Vertex{a, color};
+        *out++ = sf::Vertex{c, color};
+        *out++ = sf::Vertex{d, color};
+        return out;
+    }
+}
+
+ParticleRenderer::ParticleRenderer()
+    : m_triangles(sf::PrimitiveType::Triangles)
+    , m_trails(sf::PrimitiveType::Lines) {
+}
+
+void ParticleRenderer::render(sf::RenderTarget& target, const ParticleStore& particles, ViewCuller& culler) {
+    // Cull first, then size both buffers up front so the fill pass writes straight into them
+    m_visible.clear();
+    std::size_t triangleCount = 0;
+    std::size_t trailCount = 0;
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+        const float size = particles.getSize(i);
+        const float reach = particles.hasGlow(i) ? size * GLOW_SCALE : size + RING_THICKNESS;
+        if (!culler.isVisible(particles.getPosition(i), reach)) continue;
+
+        m_visible.push_back(i);
+        triangleCount += countTriangleVertices(particles, i);
+        trailCount += countTrailVertices(particles, i);
+    }
+    m_triangles.resize(triangleCount);
+    m_trails.resize(trailCount);
+
+    std::size_t triangleOffset = 0;
+    std::size_t trailOffset = 0;
+    for (std::size_t i : m_visible) {
+        trailOffset = writeTrail(particles, i, trailOffset);
+        triangleOffset = writeParticle(particles, i, triangleOffset);
+    }
+
+    // Trails go first so they stay behind the particles
+    if (trailCount > 0) {
+        target.draw(m_trails);
+    }
+    if (triangleCount > 0) {
+        target.draw(m_triangles);
+    }
+}
+
+std::size_t ParticleRenderer::countTriangleVertices(const ParticleStore& particles, std::size_t index) {
+    std::size_t count = particles.hasGlow(index) ? fanVertexCount(CIRCLE_SEGMENTS) : 0;
+    switch (particles.getShape(index)) {
+        case ParticleShape::Circle: count += fanVertexCount(CIRCLE_SEGMENTS); break;
+        case ParticleShape::Square: count += 6; break;
+        case ParticleShape::Star:   count += fanVertexCount(STAR_POINTS); break;
+        case ParticleShape::Spark:  count += 6; break;
+        case ParticleShape::Ring:   count += CIRCLE_SEGMENTS * 6; break;
+    }
+    return count;
+}
+
+std::size_t ParticleRenderer::countTrailVertices(const ParticleStore& particles, std::size_t index) {
+    std::size_t points = particles.getTrailLength(index);
+    return points > 2 ? (points - 1) * 2 : 0;
+}
+
+std::size_t ParticleRenderer::writeParticle(const ParticleStore& particles, std::size_t index, std::size_t offset) {
+    const sf::Vector2f position = particles.getPosition(index);
+    const sf::Color color = particles.getColor(index);
+    const float size = particles.getSize(index);
+    sf::Vertex* out = &m_triangles[offset];
+    sf::Vertex* const begin = out;
+
+    // Glow layer sits behind the particle body
+    if (particles.hasGlow(index)) {
+        sf::Color glowColor = color;
+        glowColor.a = static_cast<std::uint8_t>(glowColor.a * 0.3f);
+        out = writeFan(out, UNIT_CIRCLE, position, size * GLOW_SCALE, 1.f, 0.f, glowColor);
+    }
+
+    switch (particles.getShape(index)) {
+        case ParticleShape::Circle:
+            out = writeFan(out, UNIT_CIRCLE, position, size, 1.f, 0.f, color);
+            break;
+
+        case ParticleShape::Square: {
+            float radians = particles.getRotation(index) * PI / 180.f;
+            out = writeQuad(out, position, sf::Vector2f(std::cos(radians), std::sin(radians)), size, size, color);
+            break;
+        }
+
+        case ParticleShape::Star: {
+            float radians = particles.getRotation(index) * PI / 180.f;
+            out = writeFan(out, UNIT_STAR, position, size, std::cos(radians), std::sin(radians), color);
+            break;
+        }
+
+        case ParticleShape::Spark: {
+            // Elongated quad aligned with the direction of movement
+            sf::Vector2f velocity = particles.getVelocity(index);
+            float speed = std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
+            sf::Vector2f axis = speed > 0.0001f ? velocity / speed : sf::Vector2f(1.f, 0.f);
+            out = writeQuad(out, position, axis, size * 1.5f, size * 0.25f, color);
+            break;
+        }
+
+        case ParticleShape::Ring: {
+            // Outline grows outward from the radius, like sf::Shape outlines
+            const float inner = size;
+            const float outer = size + RING_THICKNESS;
+            for (std::size_t i = 0; i < CIRCLE_SEGMENTS; ++i) {
+                const sf::Vector2f& p0 = UNIT_CIRCLE[i];
+                const sf::Vector2f& p1 = UNIT_CIRCLE[(i + 1) % CIRCLE_SEGMENTS];
+                const sf::Vector2f a = position + p0 * inner;
+                const sf::Vector2f b = position + p0 * outer;
+                const sf::Vector2f c = position + p1 * outer;
+                const sf::Vector2f d = position + p1 * inner;
+                *out++ = sf::Vertex{a, color};
+                *out++ = sf::Vertex{b, color};
+                *out++ = sf::Vertex{c, color};
+                *out++ = sf::Vertex{a, color};
+                *out++ = sf::Vertex{c, color};
+                *out++ = sf::Vertex{d, color};
+            }
+            break;
+        }
+    }
+
+    return offset + static_cast<std::size_t>(out - begin);
+}
+
+std::size_t ParticleRenderer::writeTrail(const ParticleStore& particles, std::size_t index, std::size_t offset) {
+    const std::size_t length = particles.getTrailLength(index);
+    if (length <= 2) return offset;
+
+    // Line list equivalent of a strip: alpha ramps up toward the particle
+    const sf::Color color = particles.getColor(index);
+    const float count = static_cast<float>(length);
+    auto pointColor = [&](std::size_t i) {
+        sf::Color trailColor = color;
+        trailColor.a = static_cast<std::uint8_t>((static_cast<float>(i) / count) * color.a * 0.5f);
+        return trailColor;
+    };
+
+    sf::Vertex* out = &m_trails[offset];
+    sf::Vector2f previous = particles.getTrailPoint(index, 0);
+    for (std::size_t i = 1; i < length; ++i) {
+        sf::Vector2f current = particles.getTrailPoint(index, i);
+        *out++ = sf::Vertex{previous, pointColor(i - 1)};
+        *out++ = sf::Vertex{current, pointColor(i)};
+        previous = current;
+    }
+    return offset + (length - 1) * 2;
+}
@@ -0,0 +1,269 @@
+#include "ParticleStore.hpp"
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define KAIZEN_PARTICLES_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define KAIZEN_PARTICLES_SSE2 1
+#endif
+
+namespace {
+    constexpr float GRAVITY = 400.f;
+    constexpr float SPARK_GRAVITY = 100.f;  // Sparks have less gravity
+    constexpr float AIR_RESISTANCE = 0.98f;
+    constexpr std::uint32_t SHRINK_MASK = 0xFFFFFFFFu;
+}
+
+void ParticleStore::spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, const sf::Color& color,
+                          float lifetime, float size, ParticleShape shape, bool glow, float rotationSpeed,
+                          bool trail) {
+    m_positionX.push_back(position.x);
+    m_positionY.push_back(position.y);
+    m_velocityX.push_back(velocity.x);
+    m_velocityY.push_back(velocity.y);
+    m_lifetime.push_back(lifetime);
+    m_maxLifetime.push_back(lifetime);
+    m_size.push_back(size);
+    m_rotation.push_back(0.f);
+    m_rotationSpeed.push_back(rotationSpeed);
+    m_gravity.push_back(shape == ParticleShape::Spark ? SPARK_GRAVITY : GRAVITY);
+    m_shrink.push_back((shape == ParticleShape::Spark || shape == ParticleShape::Star) ? SHRINK_MASK : 0u);
+
+    m_color.push_back(color);
+    m_shape.push_back(shape);
+    m_glow.push_back(glow ? 1 : 0);
+    // Rings are static outlines, a trail would just be a dot under them
+    m_trailSlot.push_back((trail && shape != ParticleShape::Ring) ? acquireTrail() : NO_TRAIL);
+}
+
+std::uint32_t ParticleStore::acquireTrail() {
+    if (!m_freeTrails.empty()) {
+        std::uint32_t slot = m_freeTrails.back();
+        m_freeTrails.pop_back();
+        m_trails[slot].head = 0;
+        m_trails[slot].count = 0;
+        return slot;
+    }
+    m_trails.emplace_back();
+    return static_cast<std::uint32_t>(m_trails.size() - 1);
+}
+
+void ParticleStore::integrate(float deltaTime) {
+    const std::size_t count = size();
+    std::size_t i = 0;
+
+#if defined(KAIZEN_PARTICLES_AVX)
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 drag = _mm256_set1_ps(AIR_RESISTANCE);
+    for (; i + 8 <= count; i += 8) {
+        __m256 px = _mm256_loadu_ps(&m_positionX[i]);
+        __m256 py = _mm256_loadu_ps(&m_positionY[i]);
+        __m256 vx = _mm256_loadu_ps(&m_velocityX[i]);
+        __m256 vy = _mm256_loadu_ps(&m_velocityY[i]);
+        __m256 life = _mm256_loadu_ps(&m_lifetime[i]);
+        __m256 size = _mm256_loadu_ps(&m_size[i]);
+        __m256 rot = _mm256_loadu_ps(&m_rotation[i]);
+
+        px = _mm256_add_ps(px, _mm256_mul_ps(vx, dt));
+        py = _mm256_add_ps(py, _mm256_mul_ps(vy, dt));
+        life = _mm256_sub_ps(life, dt);
+        __m256 ratio = _mm256_div_ps(life, _mm256_loadu_ps(&m_maxLifetime[i]));
+        rot = _mm256_add_ps(rot, _mm256_mul_ps(_mm256_loadu_ps(&m_rotationSpeed[i]), dt));
+
+        __m256 shrunk = _mm256_mul_ps(size, _mm256_add_ps(half, _mm256_mul_ps(ratio, half)));
+        __m256 mask = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&m_shrink[i])));
+        size = _mm256_blendv_ps(size, shrunk, mask);
+
+        vy = _mm256_add_ps(vy, _mm256_mul_ps(_mm256_loadu_ps(&m_gravity[i]), dt));
+        vx = _mm256_mul_ps(vx, drag);
+        vy = _mm256_mul_ps(vy, drag);
+
+        _mm256_storeu_ps(&m_positionX[i], px);
+        _mm256_storeu_ps(&m_positionY[i], py);
+        _mm256_storeu_ps(&m_velocityX[i], vx);
+        _mm256_storeu_ps(&m_velocityY[i], vy);
+        _mm256_storeu_ps(&m_lifetime[i], life);
+        _mm256_storeu_ps(&m_size[i], size);
+        _mm256_storeu_ps(&m_rotation[i], rot);
+    }
+#elif defined(KAIZEN_PARTICLES_SSE2)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 drag = _mm_set1_ps(AIR_RESISTANCE);
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(&m_positionX[i]);
+        __m128 py = _mm_loadu_ps(&m_positionY[i]);
+        __m128 vx = _mm_loadu_ps(&m_velocityX[i]);
+        __m128 vy = _mm_loadu_ps(&m_velocityY[i]);
+        __m128 life = _mm_loadu_ps(&m_lifetime[i]);
+        __m128 size = _mm_loadu_ps(&m_size[i]);
+        __m128 rot = _mm_loadu_ps(&m_rotation[i]);
+
+        px = _mm_add_ps(px, _mm_mul_ps(vx, dt));
+        py = _mm_add_ps(py, _mm_mul_ps(vy, dt));
+        life = _mm_sub_ps(life, dt);
+        __m128 ratio = _mm_div_ps(life, _mm_loadu_ps(&m_maxLifetime[i]));
+        rot = _mm_add_ps(rot, _mm_mul_ps(_mm_loadu_ps(&m_rotationSpeed[i]), dt));
+
+        // SSE2 has no blendv: select with and/andnot/or
+        __m128 shrunk = _mm_mul_ps(size, _mm_add_ps(half, _mm_mul_ps(ratio, half)));
+        __m128 mask = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&m_shrink[i])));
+        size = _mm_or_ps(_mm_and_ps(mask, shrunk), _mm_andnot_ps(mask, size));
+
+        vy = _mm_add_ps(vy, _mm_mul_ps(_mm_loadu_ps(&m_gravity[i]), dt));
+        vx = _mm_mul_ps(vx, drag);
+        vy = _mm_mul_ps(vy, drag);
+
+        _mm_storeu_ps(&m_positionX[i], px);
+        _mm_storeu_ps(&m_positionY[i], py);
+        _mm_storeu_ps(&m_velocityX[i], vx);
+        _mm_storeu_ps(&m_velocityY[i], vy);
+        _mm_storeu_ps(&m_lifetime[i], life);
+        _mm_storeu_ps(&m_size[i], size);
+        _mm_storeu_ps(&m_rotation[i], rot);
+    }
+#endif
+
+    // Scalar fallback and SIMD remainder
+    integrateScalar(i, count, deltaTime);
+
+    recordTrails();
+}
+
+void ParticleStore::integrateScalar(std::size_t begin, std::size_t end, float deltaTime) {
+    for (std::size_t i = begin; i < end; ++i) {
+        m_positionX[i] += m_velocityX[i] * deltaTime;
+        m_positionY[i] += m_velocityY[i] * deltaTime;
+        m_lifetime[i] -= deltaTime;
+
+        float lifeRatio = m_lifetime[i] / m_maxLifetime[i];
+        m_rotation[i] += m_rotationSpeed[i] * deltaTime;
+
+        // Shrink over time for some shapes
+        if (m_shrink[i] != 0u) {
+            m_size[i] = m_size[i] * (0.5f + lifeRatio * 0.5f);
+        }
+
+        m_velocityY[i] += m_gravity[i] * deltaTime;
+        m_velocityX[i] *= AIR_RESISTANCE;
+        m_velocityY[i] *= AIR_RESISTANCE;
+    }
+}
+
+void ParticleStore::recordTrails() {
+    // Kept out of the kernel so the SIMD loop only streams hot arrays
+    for (std::size_t i = 0; i < m_trailSlot.size(); ++i) {
+        if (m_trailSlot[i] == NO_TRAIL) {
+            continue;
+        }
+        TrailRing& trail = m_trails[m_trailSlot[i]];
+        trail.points[trail.head] = sf::Vector2f(m_positionX[i], m_positionY[i]);
+        trail.head = static_cast<std::uint8_t>((trail.head + 1) & TRAIL_MASK);
+        if (trail.count < MAX_TRAIL_LENGTH) {
+            ++trail.count;
+        }
+    }
+}
+
+void ParticleStore::removeDead() {
+    const std::size_t count = size();
+    std::size_t write = 0;
+    for (std::size_t read = 0; read < count; ++read) {
+        if (m_lifetime[read] <= 0.f) {
+            if (m_trailSlot[read] != NO_TRAIL) {
+                m_freeTrails.push_back(m_trailSlot[read]);
+            }
+            continue;
+        }
+        if (write != read) {
+            m_positionX[write] = m_positionX[read];
+            m_positionY[write] = m_positionY[read];
+            m_velocityX[write] = m_velocityX[read];
+            m_velocityY[write] = m_velocityY[read];
+            m_lifetime[write] = m_lifetime[read];
+            m_maxLifetime[write] = m_maxLifetime[read];
+            m_size[write] = m_size[read];
+            m_rotation[write] = m_rotation[read];
+            m_rotationSpeed[write] = m_rotationSpeed[read];
+            m_gravity[write] = m_gravity[read];
+            m_shrink[write] = m_shrink[read];
+            m_color[write] = m_color[read];
+            m_shape[write] = m_shape[read];
+            m_glow[write] = m_glow[read];
+            m_trailSlot[write] = m_trailSlot[read];
+        }
+        ++write;
+    }
+
+    m_positionX.resize(write);
+    m_positionY.resize(write);
+    m_velocityX.resize(write);
+    m_velocityY.resize(write);
+    m_lifetime.resize(write);
+    m_maxLifetime.resize(write);
+    m_size.resize(write);
+    m_rotation.resize(write);
+    m_rotationSpeed.resize(write);
+    m_gravity.resize(write);
+    m_shrink.resize(write);
+    m_color.resize(write);
+    m_shape.resize(write);
+    m_glow.resize(write);
+    m_trailSlot.resize(write);
+}
+
+void ParticleStore::reserve(std::size_t capacity) {
+    m_positionX.reserve(capacity);
+    m_positionY.reserve(capacity);
+    m_velocityX.reserve(capacity);
+    m_velocityY.reserve(capacity);
+    m_lifetime.reserve(capacity);
+    m_maxLifetime.reserve(capacity);
+    m_size.reserve(capacity);
+    m_rotation.reserve(capacity);
+    m_rotationSpeed.reserve(capacity);
+    m_gravity.reserve(capacity);
+    m_shrink.reserve(capacity);
+    m_color.reserve(capacity);
+    m_shape.reserve(capacity);
+    m_glow.reserve(capacity);
+    m_trailSlot.reserve(capacity);
+}
+
+void ParticleStore::clear() {
+    m_positionX.clear();
+    m_positionY.clear();
+    m_velocityX.clear();
+    m_velocityY.clear();
+    m_lifetime.clear();
+    m_maxLifetime.clear();
+    m_size.clear();
+    m_rotation.clear();
+    m_rotationSpeed.clear();
+    m_gravity.clear();
+    m_shrink.clear();
+    m_color.clear();
+    m_shape.clear();
+    m_glow.clear();
+    m_trailSlot.clear();
+    m_trails.clear();
+    m_freeTrails.clear();
+}
+
+sf::Color ParticleStore::getColor(std::size_t i) const {
+    // Fade out over lifetime
+    sf::Color color = m_color[i];
+    color.a = static_cast<std::uint8_t>(getLifeRatio(i) * 255.f);
+    return color;
+}
+
+std::size_t ParticleStore::getTrailLength(std::size_t i) const {
+    return m_trailSlot[i] == NO_TRAIL ? 0 : m_trails[m_trailSlot[i]].count;
+}
+
+sf::Vector2f ParticleStore::getTrailPoint(std::size_t i, std::size_t k) const {
+    const TrailRing& trail = m_trails[m_trailSlot[i]];
+    return trail.points[(trail.head + MAX_TRAIL_LENGTH - trail.count + k) & TRAIL_MASK];
+}
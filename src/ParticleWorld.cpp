@@ -0,0 +1,48 @@
+#include "ParticleWorld.hpp"
+
+ParticleWorld& ParticleWorld::getInstance() {
+    static ParticleWorld instance;
+    return instance;
+}
+
+bool ParticleWorld::spawn(ParticleLayer layer, const sf::Vector2f& position, const sf::Vector2f& velocity,
+                          const sf::Color& color, float lifetime, float size,
+                          ParticleShape shape, bool glow, float rotationSpeed, bool trail) {
+    if (getParticleCount() >= MAX_PARTICLES) {
+        return false;
+    }
+
+    m_layers[static_cast<std::size_t>(layer)].spawn(position, velocity, color, lifetime, size,
+                                                    shape, glow, rotationSpeed, trail);
+    return true;
+}
+
+void ParticleWorld::update(float deltaTime) {
+    for (auto& particles : m_layers) {
+        particles.integrate(deltaTime);
+        particles.removeDead();
+    }
+}
+
+void ParticleWorld::render(sf::RenderTarget& target, ParticleLayer layer, ViewCuller& culler) {
+    const std::size_t index = static_cast<std::size_t>(layer);
+    m_renderers[index].render(target, m_layers[index], culler);
+}
+
+void ParticleWorld::clear() {
+    for (auto& particles : m_layers) {
+        particles.clear();
+    }
+}
+
+std::size_t ParticleWorld::getParticleCount() const {
+    std::size_t count = 0;
+    for (const auto& particles : m_layers) {
+        count += particles.size();
+    }
+    return count;
+}
+
+std::size_t ParticleWorld::getParticleCount(ParticleLayer layer) const {
+    return m_layers[static_cast<std::size_t>(layer)].size();
+}
@@ -1,9 +1,35 @@
 #include "Physics.hpp"
 #include <cmath>
 #include <algorithm>
+#include <limits>
 
 namespace Physics {
 
+namespace {
+
+// Time window [entry, exit] during which the boxes overlap along one axis
+void axisOverlapWindow(float boxMin, float boxSize, float targetMin, float targetSize, float delta,
+                       float& entry, float& exit) {
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    float boxMax = boxMin + boxSize;
+    float targetMax = targetMin + targetSize;
+    
+    if (delta == 0.f) {
+        // Not moving on this axis: overlapping for the whole tick or never
+        bool overlapping = boxMax > targetMin && boxMin < targetMax;
+        entry = overlapping ? -INF : INF;
+        exit = overlapping ? INF : -INF;
+        return;
+    }
+    
+    float toNear = (targetMin - boxMax) / delta;
+    float toFar = (targetMax - boxMin) / delta;
+    entry = std::min(toNear, toFar);
+    exit = std::max(toNear, toFar);
+}
+
+} // namespace
+
 sf::Vector2f applyGravity(const sf::Vector2f& velocity, float deltaTime) {
     sf::Vector2f newVelocity = velocity;
     newVelocity.y += GRAVITY * deltaTime;
@@ -38,4 +64,28 @@ sf::Vector2f clampVelocity(const sf::Vector2f& velocity, float maxSpeed) {
     return velocity;
 }
 
+SweepHit sweepAABB(const sf::FloatRect& box, const sf::Vector2f& displacement, const sf::FloatRect& target) {
+    float entryX, exitX, entryY, exitY;
+    axisOverlapWindow(box.position.x, box.size.x, target.position.x, target.size.x, displacement.x, entryX, exitX);
+    axisOverlapWindow(box.position.y, box.size.y, target.position.y, target.size.y, displacement.y, entryY, exitY);
+    
+    // Boxes touch once both axes overlap, and separate when either stops
+    float entry = std::max(entryX, entryY);
+    float exit = std::min(exitX, exitY);
+    
+    SweepHit result;
+    if (entry >= exit || entry < 0.f || entry > 1.f) {
+        return result;
+    }
+    
+    result.hit = true;
+    result.time = entry;
+    if (entryX > entryY) {
+        result.normal.x = displacement.x > 0.f ? -1.f : 1.f;
+    } else {
+        result.normal.y = displacement.y > 0.f ? -1.f : 1.f;
+    }
+    return result;
+}
+
 } // namespace Physics
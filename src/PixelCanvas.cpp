@@ -0,0 +1,91 @@
+#include "PixelCanvas.hpp"
+#include <algorithm>
+#include <cstring>
+
+PixelCanvas::PixelCanvas(unsigned int width, unsigned int height, const sf::Color& background,
+                         const sf::Vector2i& origin)
+    : m_width(width)
+    , m_height(height)
+    , m_origin(origin)
+    , m_pixels(static_cast<std::size_t>(width) * height, pack(background))
+{
+}
+
+std::uint32_t PixelCanvas::pack(const sf::Color& color) {
+    // Same byte order as sf::Image on any endianness
+    const std::uint8_t bytes[4] = {color.r, color.g, color.b, color.a};
+    std::uint32_t packed;
+    std::memcpy(&packed, bytes, sizeof(packed));
+    return packed;
+}
+
+bool PixelCanvas::clip(int& x, int& y, int& width, int& height) const {
+    x -= m_origin.x;
+    y -= m_origin.y;
+    int right = std::min(x + width, static_cast<int>(m_width));
+    int bottom = std::min(y + height, static_cast<int>(m_height));
+    x = std::max(x, 0);
+    y = std::max(y, 0);
+    width = right - x;
+    height = bottom - y;
+    return width > 0 && height > 0;
+}
+
+void PixelCanvas::fillRect(int x, int y, int width, int height, const sf::Color& color) {
+    if (!clip(x, y, width, height)) return;
+
+    const std::uint32_t packed = pack(color);
+    std::uint32_t* row = m_pixels.data() + static_cast<std::size_t>(y) * m_width + x;
+    for (int dy = 0; dy < height; ++dy, row += m_width) {
+        std::fill_n(row, width, packed);
+    }
+}
+
+void PixelCanvas::setPixel(int x, int y, const sf::Color& color) {
+    fillRect(x, y, 1, 1, color);
+}
+
+void PixelCanvas::blendRect(int x, int y, int width, int height, const sf::Color& color) {
+    if (!clip(x, y, width, height)) return;
+
+    const std::uint32_t packed = pack(color);
+    const std::uint32_t alphaMask = pack(sf::Color(0, 0, 0, 255));
+    const std::uint32_t colorAlpha = packed & alphaMask;
+    std::uint32_t* row = m_pixels.data() + static_cast<std::size_t>(y) * m_width + x;
+    for (int dy = 0; dy < height; ++dy, row += m_width) {
+        for (int dx = 0; dx < width; ++dx) {
+            const std::uint32_t existing = row[dx];
+            // Per-byte floor((a + b) / 2) without unpacking: shared bits plus half the differing ones
+            const std::uint32_t average = (existing & packed) + (((existing ^ packed) & 0xFEFEFEFEu) >> 1);
+            const std::uint32_t alpha = std::max(existing & alphaMask, colorAlpha);
+            row[dx] = (average & ~alphaMask) | alpha;
+        }
+    }
+}
+
+void PixelCanvas::blendPixel(int x, int y, const sf::Color& color) {
+    blendRect(x, y, 1, 1, color);
+}
+
+void PixelCanvas::blit(const PixelCanvas& source) {
+    int x = source.m_origin.x;
+    int y = source.m_origin.y;
+    int width = static_cast<int>(source.m_width);
+    int height = static_cast<int>(source.m_height);
+    const int sourceX = x;
+    const int sourceY = y;
+    if (!clip(x, y, width, height)) return;
+
+    // Where the clipped area starts inside the source buffer
+    const int skipX = x + m_origin.x - sourceX;
+    const int skipY = y + m_origin.y - sourceY;
+    const std::uint32_t* from = source.m_pixels.data() + static_cast<std::size_t>(skipY) * source.m_width + skipX;
+    std::uint32_t* to = m_pixels.data() + static_cast<std::size_t>(y) * m_width + x;
+    for (int dy = 0; dy < height; ++dy, from += source.m_width, to += m_width) {
+        std::copy_n(from, width, to);
+    }
+}
+
+sf::Image PixelCanvas::toImage() const {
+    return sf::Image({m_width, m_height}, reinterpret_cast<const std::uint8_t*>(m_pixels.data()));
+}
@@ -1,4 +1,5 @@
 #include "Platform.hpp"
+#include "SpriteBatch.hpp"
 #include <cmath>
 
 static sf::Vector2f normalize(const sf::Vector2f& v) {
@@ -39,14 +40,36 @@ Platform::Platform(float x, float y, float width, float height,
     }
 }
 
-void Platform::render(sf::RenderWindow& window) const {
-    sf::RectangleShape shape(m_size);
-    shape.setPosition(m_position);
-    shape.setFillColor(m_color);
-    shape.setOutlineColor(sf::Color(150, 150, 150));
-    shape.setOutlineThickness(2.f);
-    
-    window.draw(shape);
+void Platform::render(SpriteBatch& batch, float alpha) const {
+    sf::Vertex vertices[VERTEX_COUNT];
+    writeVertices(vertices, alpha);
+    batch.submit(vertices, VERTEX_COUNT, nullptr, RenderLayer::Level);
+}
+
+void Platform::writeVertices(sf::Vertex* out, float alpha) const {
+    // Same look as an outlined sf::RectangleShape: fill first, outline grows outward
+    const sf::Vector2f position = m_prevPosition + (m_position - m_prevPosition) * alpha;
+    const sf::Color outlineColor(150, 150, 150);
+    const float t = OUTLINE_THICKNESS;
+
+    auto quad = [&out](float left, float top, float width, float height, const sf::Color& color) {
+        const sf::Vector2f a(left, top);
+        const sf::Vector2f b(left + width, top);
+        const sf::Vector2f c(left + width, top + height);
+        const sf::Vector2f d(left, top + height);
+        *out++ = sf::Vertex{a, color};
+        *out++ = sf::Vertex{b, color};
+        *out++ = sf::Vertex{c, color};
+        *out++ = sf::Vertex{a, color};
+        *out++ = sf::Vertex{c, color};
+        *out++ = sf::Vertex{d, color};
+    };
+
+    quad(position.x, position.y, m_size.x, m_size.y, m_color);
+    quad(position.x - t, position.y - t, m_size.x + 2.f * t, t, outlineColor);  // Top
+    quad(position.x - t, position.y + m_size.y, m_size.x + 2.f * t, t, outlineColor);  // Bottom
+    quad(position.x - t, position.y, t, m_size.y, outlineColor);  // Left
+    quad(position.x + m_size.x, position.y, t, m_size.y, outlineColor);  // Right
 }
 
 void Platform::update(float deltaTime) {
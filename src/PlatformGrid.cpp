@@ -0,0 +1,141 @@
+#include "PlatformGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+PlatformGrid::PlatformGrid(float cellSize)
+    : m_cellSize(cellSize)
+    , m_origin(0.f, 0.f)
+    , m_columns(0)
+    , m_rows(0)
+{
+}
+
+void PlatformGrid::build(const std::vector<Platform>& platforms) {
+    m_cellStart.clear();
+    m_staticIndices.clear();
+    m_movingPlatforms.clear();
+    m_dynamicCells.clear();
+    m_dirtyCells.clear();
+    m_columns = 0;
+    m_rows = 0;
+    
+    if (platforms.empty()) return;
+    
+    // Grid covers the bounding box of the level geometry
+    sf::Vector2f minCorner = platforms.front().getPosition();
+    sf::Vector2f maxCorner = minCorner;
+    for (const auto& platform : platforms) {
+        sf::FloatRect bounds = platform.getBounds();
+        minCorner.x = std::min(minCorner.x, bounds.position.x);
+        minCorner.y = std::min(minCorner.y, bounds.position.y);
+        maxCorner.x = std::max(maxCorner.x, bounds.position.x + bounds.size.x);
+        maxCorner.y = std::max(maxCorner.y, bounds.position.y + bounds.size.y);
+    }
+    m_origin = minCorner;
+    m_columns = std::max(1, static_cast<int>(std::ceil((maxCorner.x - minCorner.x) / m_cellSize)));
+    m_rows = std::max(1, static_cast<int>(std::ceil((maxCorner.y - minCorner.y) / m_cellSize)));
+    const std::size_t cellCount = static_cast<std::size_t>(m_columns) * m_rows;
+    
+    // Counting pass, then prefix sum, then fill (static platforms only)
+    std::vector<std::uint32_t> counts(cellCount, 0);
+    for (std::size_t i = 0; i < platforms.size(); ++i) {
+        if (platforms[i].isMoving()) {
+            m_movingPlatforms.push_back(static_cast<std::uint32_t>(i));
+            continue;
+        }
+        CellRange range = cellsFor(platforms[i].getBounds());
+        for (int y = range.minY; y <= range.maxY; ++y) {
+            for (int x = range.minX; x <= range.maxX; ++x) {
+                ++counts[cellIndex(x, y)];
+            }
+        }
+    }
+    
+    m_cellStart.assign(cellCount + 1, 0);
+    for (std::size_t c = 0; c < cellCount; ++c) {
+        m_cellStart[c + 1] = m_cellStart[c] + counts[c];
+    }
+    m_staticIndices.resize(m_cellStart[cellCount]);
+    
+    std::vector<std::uint32_t> cursor(m_cellStart.begin(), m_cellStart.end() - 1);
+    for (std::size_t i = 0; i < platforms.size(); ++i) {
+        if (platforms[i].isMoving()) continue;
+        CellRange range = cellsFor(platforms[i].getBounds());
+        for (int y = range.minY; y <= range.maxY; ++y) {
+            for (int x = range.minX; x <= range.maxX; ++x) {
+                m_staticIndices[cursor[cellIndex(x, y)]++] = static_cast<std::uint32_t>(i);
+            }
+        }
+    }
+    
+    m_dynamicCells.resize(cellCount);
+    refreshDynamic(platforms);
+}
+
+void PlatformGrid::refreshDynamic(const std::vector<Platform>& platforms) {
+    // Only the cells touched last time need clearing
+    for (std::size_t cell : m_dirtyCells) {
+        m_dynamicCells[cell].clear();
+    }
+    m_dirtyCells.clear();
+    
+    for (std::uint32_t index : m_movingPlatforms) {
+        CellRange range = cellsFor(platforms[index].getBounds());
+        for (int y = range.minY; y <= range.maxY; ++y) {
+            for (int x = range.minX; x <= range.maxX; ++x) {
+                std::size_t cell = cellIndex(x, y);
+                if (m_dynamicCells[cell].empty()) {
+                    m_dirtyCells.push_back(cell);
+                }
+                m_dynamicCells[cell].push_back(index);
+            }
+        }
+    }
+}
+
+void PlatformGrid::query(const sf::FloatRect& area, std::vector<std::size_t>& out) const {
+    out.clear();
+    if (m_columns == 0) return;
+    
+    CellRange range = cellsFor(area);
+    for (int y = range.minY; y <= range.maxY; ++y) {
+        for (int x = range.minX; x <= range.maxX; ++x) {
+            std::size_t cell = cellIndex(x, y);
+            for (std::uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+                out.push_back(m_staticIndices[i]);
+            }
+            for (std::uint32_t index : m_dynamicCells[cell]) {
+                out.push_back(index);
+            }
+        }
+    }
+    
+    // Platforms spanning several cells show up more than once
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+std::uint64_t PlatformGrid::cellKey(const sf::FloatRect& area) const {
+    if (m_columns == 0) return 0;
+    
+    // Row-major on the top-left cell first so nearby bodies sort together
+    CellRange range = cellsFor(area);
+    return (static_cast<std::uint64_t>(range.minY) << 48) |
+           (static_cast<std::uint64_t>(range.minX) << 32) |
+           (static_cast<std::uint64_t>(range.maxY) << 16) |
+           static_cast<std::uint64_t>(range.maxX);
+}
+
+PlatformGrid::CellRange PlatformGrid::cellsFor(const sf::FloatRect& bounds) const {
+    auto toCell = [this](float value, float origin, int count) {
+        int cell = static_cast<int>(std::floor((value - origin) / m_cellSize));
+        return std::clamp(cell, 0, count - 1);
+    };
+    
+    CellRange range;
+    range.minX = toCell(bounds.position.x, m_origin.x, m_columns);
+    range.minY = toCell(bounds.position.y, m_origin.y, m_rows);
+    range.maxX = toCell(bounds.position.x + bounds.size.x, m_origin.x, m_columns);
+    range.maxY = toCell(bounds.position.y + bounds.size.y, m_origin.y, m_rows);
+    return range;
+}
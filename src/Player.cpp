@@ -1,21 +1,27 @@
 #include "Player.hpp"
 #include "Physics.hpp"
-#include "PixelArtGenerator.hpp"
-#include <SFML/Window/Keyboard.hpp>
+#include "ResourceManager.hpp"
+#include "SpriteBatch.hpp"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
-#include <SFML/Window/Joystick.hpp>
 
-Player::Player()
-    : Entity()
+Player::Player(EntityStore& store)
+    : Entity(store)
     , m_onGround(false)
     , m_facingRight(true)
     , m_jumpCount(0)
     , m_onWall(false)
     , m_wallOnRight(false)
     , m_wallSlideTimer(0.0f)
+    , m_input()
     , m_inputDirection(0.f)
+    , m_wasJumpPressed(false)
+    , m_wasLightAttackPressed(false)
+    , m_wasHeavyAttackPressed(false)
+    , m_wasParryPressed(false)
+    , m_wasSpiritStrikePressed(false)
+    , m_wasEchoPressed(false)
     , m_isAttacking(false)
     , m_attackCooldown(0.0f)
     , m_isParrying(false)
@@ -42,9 +48,7 @@ Player::Player()
     , m_jumpInputBuffered(false)
     , m_jumpInputBufferTime(0.0f)
     , m_sprite(std::nullopt)
-    , m_texture()
     , m_animController()
-    , m_particles()
     , m_currentAnimState(AnimState::Idle)
 {
     // Set player size
@@ -56,29 +60,27 @@ Player::Player()
     // Create sprite sheet and setup animations
     createSpriteSheet();
     setupAnimations();
-    m_sprite.emplace(m_texture);
+    if (m_sheet.texture) {
+        m_sprite.emplace(*m_sheet.texture);
+    }
     m_animController.setAnimation("idle");
 }
 
 void Player::createSpriteSheet() {
-    // Use the high-quality pixel art generator to create detailed player sprites
-    m_texture = PixelArtGenerator::createPlayerSpriteSheet();
-    m_texture.setSmooth(false);  // Pixel art style
+    // One generated sheet is shared by every player
+    m_sheet = ResourceManager::getInstance().acquireSpriteSheet(SpriteSheetKind::Player);
 }
 
 void Player::setupAnimations() {
-    // New sprite sheet layout: 1024x320 with 128x40 frames
+    // Sprite sheet layout: 1024x320 with 128x40 frames, placed in the sprite atlas
     // 8 rows (IDLE, RUN, JUMP, FALL, ATTACK, PARRY, DASH, SPIRIT_STRIKE)
     // 8 frames per row
     
-    const int frameWidth = 128;
-    const int frameHeight = 40;
-    
     // Idle animation (row 0) - 8 frames with breathing effect
     Animation idleAnim;
     for (int i = 0; i < 8; i++) {
         float frameDuration = 0.12f + (i % 4) * 0.02f;  // Subtle breathing variation
-        idleAnim.addFrame(sf::IntRect({i * frameWidth, 0 * frameHeight}, {frameWidth, frameHeight}), frameDuration);
+        idleAnim.addFrame(m_sheet.getFrame(i, 0), frameDuration);
     }
     m_animController.addAnimation("idle", idleAnim);
     
@@ -86,54 +88,54 @@ void Player::setupAnimations() {
     Animation runAnim;
     for (int i = 0; i < 8; i++) {
         float frameDuration = 0.06f;  // Fast run cycle
-        runAnim.addFrame(sf::IntRect({i * frameWidth, 1 * frameHeight}, {frameWidth, frameHeight}), frameDuration);
+        runAnim.addFrame(m_sheet.getFrame(i, 1), frameDuration);
     }
     m_animController.addAnimation("run", runAnim);
     
     // Jump animation (row 2) - 4 frames with better pacing
     Animation jumpAnim;
-    jumpAnim.addFrame(sf::IntRect({0 * frameWidth, 2 * frameHeight}, {frameWidth, frameHeight}), 0.08f);  // Launch
-    jumpAnim.addFrame(sf::IntRect({1 * frameWidth, 2 * frameHeight}, {frameWidth, frameHeight}), 0.10f);  // Peak ascent
-    jumpAnim.addFrame(sf::IntRect({2 * frameWidth, 2 * frameHeight}, {frameWidth, frameHeight}), 0.10f);  // Apex
-    jumpAnim.addFrame(sf::IntRect({3 * frameWidth, 2 * frameHeight}, {frameWidth, frameHeight}), 0.08f);  // Descent
+    jumpAnim.addFrame(m_sheet.getFrame(0, 2), 0.08f);  // Launch
+    jumpAnim.addFrame(m_sheet.getFrame(1, 2), 0.10f);  // Peak ascent
+    jumpAnim.addFrame(m_sheet.getFrame(2, 2), 0.10f);  // Apex
+    jumpAnim.addFrame(m_sheet.getFrame(3, 2), 0.08f);  // Descent
     jumpAnim.setLooping(false);
     m_animController.addAnimation("jump", jumpAnim);
     
     // Fall animation (row 3) - 4 frames
     Animation fallAnim;
     for (int i = 0; i < 4; i++) {
-        fallAnim.addFrame(sf::IntRect({i * frameWidth, 3 * frameHeight}, {frameWidth, frameHeight}), 0.1f);
+        fallAnim.addFrame(m_sheet.getFrame(i, 3), 0.1f);
     }
     m_animController.addAnimation("fall", fallAnim);
     
     // Attack animation (row 4) - 6 frames with wind-up, strike, and recovery
     Animation attackAnim;
-    attackAnim.addFrame(sf::IntRect({0 * frameWidth, 4 * frameHeight}, {frameWidth, frameHeight}), 0.06f);  // Wind-up start
-    attackAnim.addFrame(sf::IntRect({1 * frameWidth, 4 * frameHeight}, {frameWidth, frameHeight}), 0.05f);  // Wind-up
-    attackAnim.addFrame(sf::IntRect({2 * frameWidth, 4 * frameHeight}, {frameWidth, frameHeight}), 0.04f);  // Strike initiate
-    attackAnim.addFrame(sf::IntRect({3 * frameWidth, 4 * frameHeight}, {frameWidth, frameHeight}), 0.06f);  // Full strike
-    attackAnim.addFrame(sf::IntRect({4 * frameWidth, 4 * frameHeight}, {frameWidth, frameHeight}), 0.08f);  // Recovery
-    attackAnim.addFrame(sf::IntRect({5 * frameWidth, 4 * frameHeight}, {frameWidth, frameHeight}), 0.08f);  // Recovery end
+    attackAnim.addFrame(m_sheet.getFrame(0, 4), 0.06f);  // Wind-up start
+    attackAnim.addFrame(m_sheet.getFrame(1, 4), 0.05f);  // Wind-up
+    attackAnim.addFrame(m_sheet.getFrame(2, 4), 0.04f);  // Strike initiate
+    attackAnim.addFrame(m_sheet.getFrame(3, 4), 0.06f);  // Full strike
+    attackAnim.addFrame(m_sheet.getFrame(4, 4), 0.08f);  // Recovery
+    attackAnim.addFrame(m_sheet.getFrame(5, 4), 0.08f);  // Recovery end
     attackAnim.setLooping(false);
     m_animController.addAnimation("attack", attackAnim);
     
     // Parry animation (row 5) - 6 frames with shield up and return
     Animation parryAnim;
-    parryAnim.addFrame(sf::IntRect({0 * frameWidth, 5 * frameHeight}, {frameWidth, frameHeight}), 0.05f);  // Raise shield
-    parryAnim.addFrame(sf::IntRect({1 * frameWidth, 5 * frameHeight}, {frameWidth, frameHeight}), 0.04f);  // Shield up fast
-    parryAnim.addFrame(sf::IntRect({2 * frameWidth, 5 * frameHeight}, {frameWidth, frameHeight}), 0.15f);  // Shield hold
-    parryAnim.addFrame(sf::IntRect({3 * frameWidth, 5 * frameHeight}, {frameWidth, frameHeight}), 0.15f);  // Shield hold cont
-    parryAnim.addFrame(sf::IntRect({4 * frameWidth, 5 * frameHeight}, {frameWidth, frameHeight}), 0.06f);  // Lower shield
-    parryAnim.addFrame(sf::IntRect({5 * frameWidth, 5 * frameHeight}, {frameWidth, frameHeight}), 0.06f);  // Return
+    parryAnim.addFrame(m_sheet.getFrame(0, 5), 0.05f);  // Raise shield
+    parryAnim.addFrame(m_sheet.getFrame(1, 5), 0.04f);  // Shield up fast
+    parryAnim.addFrame(m_sheet.getFrame(2, 5), 0.15f);  // Shield hold
+    parryAnim.addFrame(m_sheet.getFrame(3, 5), 0.15f);  // Shield hold cont
+    parryAnim.addFrame(m_sheet.getFrame(4, 5), 0.06f);  // Lower shield
+    parryAnim.addFrame(m_sheet.getFrame(5, 5), 0.06f);  // Return
     parryAnim.setLooping(false);
     m_animController.addAnimation("parry", parryAnim);
     
     // Dash animation (row 6) - 4 frames with burst effect
     Animation dashAnim;
-    dashAnim.addFrame(sf::IntRect({0 * frameWidth, 6 * frameHeight}, {frameWidth, frameHeight}), 0.04f);  // Burst start
-    dashAnim.addFrame(sf::IntRect({1 * frameWidth, 6 * frameHeight}, {frameWidth, frameHeight}), 0.04f);  // Mid-dash
-    dashAnim.addFrame(sf::IntRect({2 * frameWidth, 6 * frameHeight}, {frameWidth, frameHeight}), 0.05f);  // Fast dash
-    dashAnim.addFrame(sf::IntRect({3 * frameWidth, 6 * frameHeight}, {frameWidth, frameHeight}), 0.05f);  // Dash end
+    dashAnim.addFrame(m_sheet.getFrame(0, 6), 0.04f);  // Burst start
+    dashAnim.addFrame(m_sheet.getFrame(1, 6), 0.04f);  // Mid-dash
+    dashAnim.addFrame(m_sheet.getFrame(2, 6), 0.05f);  // Fast dash
+    dashAnim.addFrame(m_sheet.getFrame(3, 6), 0.05f);  // Dash end
     dashAnim.setLooping(false);
     m_animController.addAnimation("dash", dashAnim);
     
@@ -141,7 +143,7 @@ void Player::setupAnimations() {
     // In a full game, this would be a dedicated ledge hang animation
     Animation ledgeAnim;
     for (int i = 0; i < 4; i++) {
-        ledgeAnim.addFrame(sf::IntRect({i * frameWidth, 7 * frameHeight}, {frameWidth, frameHeight}), 0.2f);
+        ledgeAnim.addFrame(m_sheet.getFrame(i, 7), 0.2f);
     }
     ledgeAnim.setLooping(true);
     m_animController.addAnimation("ledge", ledgeAnim);
@@ -150,12 +152,12 @@ void Player::setupAnimations() {
     // Note: In the current sprite sheet, this overwrites the spirit strike position
     // In production, expand sprite sheet or reuse existing animations
     Animation spiritAnim;
-    spiritAnim.addFrame(sf::IntRect({0 * frameWidth, 7 * frameHeight}, {frameWidth, frameHeight}), 0.08f);  // Charge start
-    spiritAnim.addFrame(sf::IntRect({1 * frameWidth, 7 * frameHeight}, {frameWidth, frameHeight}), 0.07f);  // Charging
-    spiritAnim.addFrame(sf::IntRect({2 * frameWidth, 7 * frameHeight}, {frameWidth, frameHeight}), 0.06f);  // Energy building
-    spiritAnim.addFrame(sf::IntRect({3 * frameWidth, 7 * frameHeight}, {frameWidth, frameHeight}), 0.05f);  // Full charge
-    spiritAnim.addFrame(sf::IntRect({4 * frameWidth, 7 * frameHeight}, {frameWidth, frameHeight}), 0.08f);  // Release
-    spiritAnim.addFrame(sf::IntRect({5 * frameWidth, 7 * frameHeight}, {frameWidth, frameHeight}), 0.12f);  // Cooldown
+    spiritAnim.addFrame(m_sheet.getFrame(0, 7), 0.08f);  // Charge start
+    spiritAnim.addFrame(m_sheet.getFrame(1, 7), 0.07f);  // Charging
+    spiritAnim.addFrame(m_sheet.getFrame(2, 7), 0.06f);  // Energy building
+    spiritAnim.addFrame(m_sheet.getFrame(3, 7), 0.05f);  // Full charge
+    spiritAnim.addFrame(m_sheet.getFrame(4, 7), 0.08f);  // Release
+    spiritAnim.addFrame(m_sheet.getFrame(5, 7), 0.12f);  // Cooldown
     spiritAnim.setLooping(false);
     m_animController.addAnimation("spirit_strike", spiritAnim);
 }
@@ -172,13 +174,13 @@ void Player::updateAnimation(float deltaTime) {
         newState = AnimState::Dash;
     } else if (m_isParrying) {
         newState = AnimState::Parry;
-    } else if (!m_activeAttacks.empty()) {
+    } else if (!m_attacks.isEmpty()) {
         newState = AnimState::Attack;
     } else if (isWallSliding()) {
         newState = AnimState::Fall;
     } else if (!m_onGround) {
-        newState = (m_velocity.y < 0) ? AnimState::Jump : AnimState::Fall;
-    } else if (std::abs(m_velocity.x) > 10.f) {
+        newState = (m_body->velocity.y < 0) ? AnimState::Jump : AnimState::Fall;
+    } else if (std::abs(m_body->velocity.x) > 10.f) {
         newState = AnimState::Run;
     } else {
         newState = AnimState::Idle;
@@ -222,38 +224,23 @@ void Player::handleInput() {
     m_inputDirection = 0.f;
     
     // Horizontal movement
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A) || 
-        sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left)) {
+    if (m_input.moveX < 0.f) {
         m_inputDirection = -1.f;
         m_facingRight = false;
     }
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D) || 
-             sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right)) {
+    else if (m_input.moveX > 0.f) {
         m_inputDirection = 1.f;
         m_facingRight = true;
     }
-
-    // Controller movement via joystick axis
-    if (sf::Joystick::isConnected(0)) {
-        float axisX = sf::Joystick::getAxisPosition(0, sf::Joystick::Axis::X);
-        if (std::abs(axisX) > 30.f) {
-            m_inputDirection = (axisX > 0.f) ? 1.f : -1.f;
-            m_facingRight = axisX > 0.f;
-        }
-    }
     
     // Jump (with input buffering for better feel)
-    static bool wasJumpPressed = false;
-    bool isJumpPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) ||
-                         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W) ||
-                         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up) ||
-                         (sf::Joystick::isConnected(0) && sf::Joystick::isButtonPressed(0, 0));
+    bool isJumpPressed = m_input.jump;
     
     // Detect jump button press (not hold)
-    if (isJumpPressed && !wasJumpPressed) {
+    if (isJumpPressed && !m_wasJumpPressed) {
         jump();
     }
-    wasJumpPressed = isJumpPressed;
+    m_wasJumpPressed = isJumpPressed;
     
     // Update facing direction while on wall (allow turning away from wall)
     if (m_onWall && m_inputDirection != 0.f) {
@@ -268,72 +255,55 @@ void Player::handleInput() {
     // Attack inputs (only when not on cooldown)
     if (m_attackCooldown <= 0.0f && !m_isParrying) {
         // Light attack - J key
-        static bool wasLightAttackPressed = false;
-        bool isLightAttackPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::J) ||
-                                    (sf::Joystick::isConnected(0) && sf::Joystick::isButtonPressed(0, 2));
+        bool isLightAttackPressed = m_input.lightAttack;
         
-        if (isLightAttackPressed && !wasLightAttackPressed) {
+        if (isLightAttackPressed && !m_wasLightAttackPressed) {
             performLightAttack();
             if (m_echoActive && m_echoTimer <= ECHO_CANCEL_WINDOW) { m_echoActive = false; }
         }
-        wasLightAttackPressed = isLightAttackPressed;
+        m_wasLightAttackPressed = isLightAttackPressed;
         
         // Heavy attack - K key (hold to charge)
-        static bool wasHeavyAttackPressed = false;
-        bool isHeavyAttackPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::K) ||
-                                    (sf::Joystick::isConnected(0) && sf::Joystick::isButtonPressed(0, 3));
+        bool isHeavyAttackPressed = m_input.heavyAttack;
         
-        if (isHeavyAttackPressed && !wasHeavyAttackPressed) {
+        if (isHeavyAttackPressed && !m_wasHeavyAttackPressed) {
             // Start charging
             startChargingHeavy();
-        } else if (!isHeavyAttackPressed && wasHeavyAttackPressed) {
+        } else if (!isHeavyAttackPressed && m_wasHeavyAttackPressed) {
             // Released - fire charged attack
             releaseHeavyAttack();
             if (m_echoActive && m_echoTimer <= ECHO_CANCEL_WINDOW) { m_echoActive = false; }
         }
-        wasHeavyAttackPressed = isHeavyAttackPressed;
+        m_wasHeavyAttackPressed = isHeavyAttackPressed;
     }
     
     // Parry - P key (kept separate from jump to avoid conflicts)
-    static bool wasParryPressed = false;
-    bool isParryPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::P) ||
-                          (sf::Joystick::isConnected(0) && sf::Joystick::isButtonPressed(0, 1));
+    bool isParryPressed = m_input.parry;
     
-    if (isParryPressed && !wasParryPressed && m_parryTimer <= 0.0f && !m_isAttacking && !m_isParrying) {
+    if (isParryPressed && !m_wasParryPressed && m_parryTimer <= 0.0f && !m_isAttacking && !m_isParrying) {
         performParry();
     }
-    wasParryPressed = isParryPressed;
+    m_wasParryPressed = isParryPressed;
     
     // Spirit Strike - Q key (magic enhancement)
-    static bool wasSpiritStrikePressed = false;
-    bool isSpiritStrikePressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Q) ||
-                                (sf::Joystick::isConnected(0) && sf::Joystick::isButtonPressed(0, 4));
+    bool isSpiritStrikePressed = m_input.spiritStrike;
     
-    if (isSpiritStrikePressed && !wasSpiritStrikePressed && m_spiritStrikeCooldown <= 0.0f && !m_spiritStrikeActive) {
+    if (isSpiritStrikePressed && !m_wasSpiritStrikePressed && m_spiritStrikeCooldown <= 0.0f && !m_spiritStrikeActive) {
         activateSpiritStrike();
     }
-    wasSpiritStrikePressed = isSpiritStrikePressed;
+    m_wasSpiritStrikePressed = isSpiritStrikePressed;
 
     // Echo Step - E key (dash with brief invulnerability)
-    static bool wasEchoPressed = false;
-    bool isEchoPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::E) ||
-                         (sf::Joystick::isConnected(0) && sf::Joystick::isButtonPressed(0, 5));
+    bool isEchoPressed = m_input.echoStep;
 
-    if (isEchoPressed && !wasEchoPressed && m_echoCooldown <= 0.0f && !m_echoActive) {
+    if (isEchoPressed && !m_wasEchoPressed && m_echoCooldown <= 0.0f && !m_echoActive) {
         activateEchoStep();
     }
-    wasEchoPressed = isEchoPressed;
+    m_wasEchoPressed = isEchoPressed;
     
     // Ledge grab input handling - pull up from ledge with Up or W
     if (m_onLedge && !m_pullingUp) {
-        bool isUpPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W) ||
-                          sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up);
-        if (sf::Joystick::isConnected(0)) {
-            float axisY = sf::Joystick::getAxisPosition(0, sf::Joystick::Axis::Y);
-            if (axisY < -30.f) isUpPressed = true;
-        }
-        
-        if (isUpPressed) {
+        if (m_input.up) {
             pullUpFromLedge();
         }
     }
@@ -371,7 +341,7 @@ void Player::update(float deltaTime) {
         
         // Enhanced charging particles
         if (static_cast<int>(m_heavyChargeTime * 20.f) % 2 == 0) {
-            sf::Vector2f chargePos = m_position + sf::Vector2f(m_size.x / 2.f, m_size.y / 2.f);
+            sf::Vector2f chargePos = m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y / 2.f);
             float intensity = m_heavyChargeTime / MAX_CHARGE_TIME;
             sf::Color chargeColor = sf::Color(255, static_cast<uint8_t>(100 + 155 * intensity), 50);
             
@@ -423,27 +393,16 @@ void Player::update(float deltaTime) {
         m_jumpInputBuffered = false;
     }
     
-    // Update active attacks
-    for (auto& attack : m_activeAttacks) {
-        attack->update(deltaTime);
-    }
-    
-    // Remove inactive attacks
-    m_activeAttacks.erase(
-        std::remove_if(m_activeAttacks.begin(), m_activeAttacks.end(),
-            [](const std::unique_ptr<Attack>& attack) {
-                return !attack->isActive();
-            }),
-        m_activeAttacks.end()
-    );
+    // Update active attacks (expired ones return to the pool)
+    m_attacks.update(deltaTime);
     
     // Echo Step movement overrides input during dash
     if (m_echoActive) {
         m_echoTimer -= deltaTime;
-        m_velocity.x = (m_facingRight ? 1.f : -1.f) * ECHO_STEP_SPEED;
+        m_body->velocity.x = (m_facingRight ? 1.f : -1.f) * ECHO_STEP_SPEED;
         
         // Continuous dash trail effect
-        sf::Vector2f trailPos = m_position + sf::Vector2f(m_size.x / 2.f, m_size.y / 2.f);
+        sf::Vector2f trailPos = m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y / 2.f);
         m_particles.emitTrail(trailPos, sf::Color(150, 200, 255), 3, 5.f);
         
         if (m_echoTimer <= 0.0f) {
@@ -454,22 +413,22 @@ void Player::update(float deltaTime) {
         // Horizontal movement with acceleration
         if (m_inputDirection != 0.f) {
             float targetVelocityX = m_inputDirection * MOVE_SPEED;
-            float velocityDiff = targetVelocityX - m_velocity.x;
+            float velocityDiff = targetVelocityX - m_body->velocity.x;
             float acceleration = ACCELERATION * deltaTime;
             
             if (std::abs(velocityDiff) < acceleration) {
-                m_velocity.x = targetVelocityX;
+                m_body->velocity.x = targetVelocityX;
             } else {
-                m_velocity.x += (velocityDiff > 0 ? acceleration : -acceleration);
+                m_body->velocity.x += (velocityDiff > 0 ? acceleration : -acceleration);
             }
         }
         else {
             // Apply deceleration when no input
-            if (std::abs(m_velocity.x) < DECELERATION * deltaTime) {
-                m_velocity.x = 0.f;
+            if (std::abs(m_body->velocity.x) < DECELERATION * deltaTime) {
+                m_body->velocity.x = 0.f;
             }
             else {
-                m_velocity.x -= (m_velocity.x > 0 ? DECELERATION : -DECELERATION) * deltaTime;
+                m_body->velocity.x -= (m_body->velocity.x > 0 ? DECELERATION : -DECELERATION) * deltaTime;
             }
         }
     }
@@ -477,26 +436,26 @@ void Player::update(float deltaTime) {
     // Apply end-lag smooth deceleration
     if (m_echoEndLagTimer > 0.0f) {
         m_echoEndLagTimer -= deltaTime;
-        m_velocity.x *= 0.9f; // quick ease-out over end-lag
+        m_body->velocity.x *= 0.9f; // quick ease-out over end-lag
     }
     
     // Apply gravity when not on ground
     if (!m_onGround) {
         // Apply wall slide physics
-        if (m_onWall && m_velocity.y > 0.f) {
+        if (m_onWall && m_body->velocity.y > 0.f) {
             // Sliding down wall - cap fall speed
-            m_velocity = Physics::applyGravity(m_velocity, deltaTime);
-            if (m_velocity.y > WALL_SLIDE_SPEED) {
-                m_velocity.y = WALL_SLIDE_SPEED;
+            m_body->velocity = Physics::applyGravity(m_body->velocity, deltaTime);
+            if (m_body->velocity.y > WALL_SLIDE_SPEED) {
+                m_body->velocity.y = WALL_SLIDE_SPEED;
             }
             // Emit wall slide particles
-            if (static_cast<int>(m_position.y) % 5 == 0) {
-                float wallX = m_wallOnRight ? (m_position.x + m_size.x) : m_position.x;
-                m_particles.emit(sf::Vector2f(wallX, m_position.y + m_size.y / 2.f),
+            if (static_cast<int>(m_transform->position.y) % 5 == 0) {
+                float wallX = m_wallOnRight ? (m_transform->position.x + m_transform->size.x) : m_transform->position.x;
+                m_particles.emit(sf::Vector2f(wallX, m_transform->position.y + m_transform->size.y / 2.f),
                                1, sf::Color(180, 180, 180), 30.f, 0.4f, 2.f);
             }
         } else {
-            m_velocity = Physics::applyGravity(m_velocity, deltaTime);
+            m_body->velocity = Physics::applyGravity(m_body->velocity, deltaTime);
         }
     }
     
@@ -529,25 +488,22 @@ void Player::update(float deltaTime) {
     // Update animation
     updateAnimation(deltaTime);
     
-    // Update particles
-    m_particles.update(deltaTime);
-
     // Update position based on velocity
     Entity::update(deltaTime);
     
     // Keep player on screen (horizontal bounds for larger level)
     constexpr float LEVEL_WIDTH = 2560.f;
-    if (m_position.x < 0.f) {
-        m_position.x = 0.f;
-        m_velocity.x = 0.f;
+    if (m_transform->position.x < 0.f) {
+        m_transform->position.x = 0.f;
+        m_body->velocity.x = 0.f;
     }
-    else if (m_position.x + m_size.x > LEVEL_WIDTH) {
-        m_position.x = LEVEL_WIDTH - m_size.x;
-        m_velocity.x = 0.f;
+    else if (m_transform->position.x + m_transform->size.x > LEVEL_WIDTH) {
+        m_transform->position.x = LEVEL_WIDTH - m_transform->size.x;
+        m_body->velocity.x = 0.f;
     }
 }
 
-void Player::render(sf::RenderWindow& window) const {
+void Player::render(SpriteBatch& batch) const {
     if (!m_sprite) return;
     
     // Update sprite texture coordinates for current animation frame
@@ -560,64 +516,59 @@ void Player::render(sf::RenderWindow& window) const {
     // Flip sprite based on facing direction and scale up
     if (!m_facingRight) {
         m_sprite->setScale(sf::Vector2f(-1.5f, 1.5f));
-        m_sprite->setPosition(m_position + sf::Vector2f(m_size.x / 2.f, m_size.y / 2.f));
+        m_sprite->setPosition(m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y / 2.f));
     } else {
         m_sprite->setScale(sf::Vector2f(1.5f, 1.5f));
-        m_sprite->setPosition(m_position + sf::Vector2f(m_size.x / 2.f, m_size.y / 2.f));
+        m_sprite->setPosition(m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y / 2.f));
     }
     
-    window.draw(*m_sprite);
-    
-    // Render particles
-    m_particles.render(window);
+    batch.submit(*m_sprite, RenderLayer::Entities);
     
     // Render Spirit Strike glow effect
     if (m_spiritStrikeActive) {
-        sf::RectangleShape glowEffect(m_size);
-        glowEffect.setPosition(m_position);
+        sf::RectangleShape glowEffect(m_transform->size);
+        glowEffect.setPosition(m_transform->position);
         glowEffect.setFillColor(sf::Color(100, 200, 255, 80)); // Ethereal blue glow
         glowEffect.setOutlineColor(sf::Color(150, 220, 255, 180));
         glowEffect.setOutlineThickness(2.f);
-        window.draw(glowEffect);
+        batch.submit(glowEffect, RenderLayer::Effects);
         
         // Emit spirit particles
-        if (static_cast<int>(m_position.x) % 3 == 0) {
-            m_particles.emit(m_position + sf::Vector2f(m_size.x / 2.f, m_size.y / 2.f), 
+        if (static_cast<int>(m_transform->position.x) % 3 == 0) {
+            m_particles.emit(m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y / 2.f), 
                            2, sf::Color(150, 220, 255), 50.f, 0.6f, 2.f);
         }
     }
     
     // Echo Step afterimages for dash visual
     if (m_echoActive) {
-        sf::RectangleShape trail1(m_size);
-        trail1.setPosition(sf::Vector2f(m_position.x - (m_facingRight ? 10.f : -10.f), m_position.y));
+        sf::RectangleShape trail1(m_transform->size);
+        trail1.setPosition(sf::Vector2f(m_transform->position.x - (m_facingRight ? 10.f : -10.f), m_transform->position.y));
         trail1.setFillColor(sf::Color(200, 240, 255, 60));
-        window.draw(trail1);
+        batch.submit(trail1, RenderLayer::Effects);
 
-        sf::RectangleShape trail2(m_size);
-        trail2.setPosition(sf::Vector2f(m_position.x - (m_facingRight ? 20.f : -20.f), m_position.y));
+        sf::RectangleShape trail2(m_transform->size);
+        trail2.setPosition(sf::Vector2f(m_transform->position.x - (m_facingRight ? 20.f : -20.f), m_transform->position.y));
         trail2.setFillColor(sf::Color(200, 240, 255, 30));
-        window.draw(trail2);
+        batch.submit(trail2, RenderLayer::Effects);
         
         // Emit dash particles
-        m_particles.emitDirectional(m_position + sf::Vector2f(m_size.x / 2.f, m_size.y), 
+        m_particles.emitDirectional(m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y), 
                                    sf::Vector2f(m_facingRight ? -1.f : 1.f, 0.f),
                                    1, sf::Color(200, 240, 255), 15.f, 150.f, 0.3f, 3.f);
     }
     
     // Render active attacks
-    for (const auto& attack : m_activeAttacks) {
-        attack->render(window);
-    }
+    m_attacks.render(batch);
     
     // Render parry visual feedback - bright blue shield
     if (m_isParrying) {
         sf::CircleShape parryIndicator(35.f);
-        parryIndicator.setPosition(sf::Vector2f(m_position.x - 20.f, m_position.y - 10.f));
+        parryIndicator.setPosition(sf::Vector2f(m_transform->position.x - 20.f, m_transform->position.y - 10.f));
         parryIndicator.setFillColor(sf::Color(50, 150, 255, 150)); // Bright blue translucent
         parryIndicator.setOutlineColor(sf::Color(100, 200, 255, 255));
         parryIndicator.setOutlineThickness(4.f);
-        window.draw(parryIndicator);
+        batch.submit(parryIndicator, RenderLayer::Effects);
     }
 }
 
@@ -626,8 +577,8 @@ void Player::jump() {
     if (m_onWall || m_wallSlideTimer > 0.0f) {
         // Wall jump - push away from wall
         bool jumpRight = !m_wallOnRight;  // Jump opposite to wall direction
-        m_velocity.x = (jumpRight ? 1.f : -1.f) * WALL_JUMP_FORCE_X;
-        m_velocity.y = WALL_JUMP_FORCE_Y;
+        m_body->velocity.x = (jumpRight ? 1.f : -1.f) * WALL_JUMP_FORCE_X;
+        m_body->velocity.y = WALL_JUMP_FORCE_Y;
         m_facingRight = jumpRight;
         m_onWall = false;
         m_wallSlideTimer = 0.0f;
@@ -635,8 +586,8 @@ void Player::jump() {
         m_coyoteTimer = 0.0f;  // Consume coyote time
         
         // Enhanced wall jump particles
-        float wallX = m_wallOnRight ? (m_position.x + m_size.x) : m_position.x;
-        sf::Vector2f wallPos(wallX, m_position.y + m_size.y / 2.f);
+        float wallX = m_wallOnRight ? (m_transform->position.x + m_transform->size.x) : m_transform->position.x;
+        sf::Vector2f wallPos(wallX, m_transform->position.y + m_transform->size.y / 2.f);
         sf::Vector2f jumpDir(jumpRight ? -1.f : 1.f, -0.5f);
         
         m_particles.emitDirectional(wallPos, jumpDir, 12, sf::Color(220, 220, 240), 45.f, 200.f, 0.7f, 3.f);
@@ -645,7 +596,7 @@ void Player::jump() {
     }
     // Allow jump if on ground or coyote time active, or if we haven't used our double jump
     else if (m_onGround || m_coyoteTimer > 0.0f || m_jumpCount < MAX_JUMPS) {
-        m_velocity.y = JUMP_FORCE;
+        m_body->velocity.y = JUMP_FORCE;
         m_jumpCount++;
         m_onGround = false;
         m_coyoteTimer = 0.0f;  // Consume coyote time on jump
@@ -653,7 +604,7 @@ void Player::jump() {
         m_jumpInputBufferTime = 0.0f;
         
         // Enhanced jump particles
-        sf::Vector2f jumpPos = m_position + sf::Vector2f(m_size.x / 2.f, m_size.y);
+        sf::Vector2f jumpPos = m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y);
         
         if (m_jumpCount == 1) {
             // First jump - ground burst
@@ -700,7 +651,7 @@ void Player::setOnWall(bool onWall, bool wallOnRight) {
                                (!wallOnRight && m_inputDirection < 0.f) ||
                                m_inputDirection == 0.f;
         
-        if (movingTowardWall || m_velocity.y > 0.f) {
+        if (movingTowardWall || m_body->velocity.y > 0.f) {
             m_onWall = true;
             m_wallOnRight = wallOnRight;
             m_wallSlideTimer = WALL_STICK_TIME;  // Give grace period for wall jump
@@ -713,16 +664,16 @@ void Player::setOnWall(bool onWall, bool wallOnRight) {
 
 void Player::setOnLedge(bool onLedge, const sf::Vector2f& ledgePos) {
     // Only grab ledge if falling and not already on ground
-    if (!m_onGround && onLedge && m_velocity.y > 0 && m_ledgeGrabCooldown <= 0.0f) {
+    if (!m_onGround && onLedge && m_body->velocity.y > 0 && m_ledgeGrabCooldown <= 0.0f) {
         m_onLedge = true;
         m_ledgePosition = ledgePos;
-        m_velocity = sf::Vector2f(0.f, 0.f);  // Stop movement
+        m_body->velocity = sf::Vector2f(0.f, 0.f);  // Stop movement
         m_jumpCount = 0;  // Reset jumps when grabbing ledge
         m_ledgeGrabCooldown = LEDGE_GRAB_COOLDOWN;
         
         // Emit ledge grab particles
         m_particles.emit(m_ledgePosition, 5, sf::Color(200, 220, 255), 60.f, 0.5f, 2.f);
-    } else if (onLedge && m_onLedge && m_velocity.y > WALL_SLIDE_SPEED) {
+    } else if (onLedge && m_onLedge && m_body->velocity.y > WALL_SLIDE_SPEED) {
         // Update ledge position while hanging
         m_ledgePosition = ledgePos;
     }
@@ -732,7 +683,7 @@ void Player::pullUpFromLedge() {
     if (m_onLedge && !m_pullingUp) {
         m_pullingUp = true;
         m_pullUpTimer = PULL_UP_DURATION;
-        m_velocity.y = -PULL_UP_HEIGHT / PULL_UP_DURATION;  // Rise smoothly
+        m_body->velocity.y = -PULL_UP_HEIGHT / PULL_UP_DURATION;  // Rise smoothly
         
         // Emit pull-up particles
         m_particles.emitBurst(m_ledgePosition, 8, sf::Color(150, 200, 255), 100.f, 200.f, 0.4f, 2.5f);
@@ -763,15 +714,8 @@ void Player::performLightAttack() {
     int particleCount = 8;
     
     // Check for up/down input (overrides combo)
-    bool upPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W) || 
-                     sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up);
-    bool downPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S) || 
-                       sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Down);
-    if (sf::Joystick::isConnected(0)) {
-        float axisY = sf::Joystick::getAxisPosition(0, sf::Joystick::Axis::Y);
-        if (axisY < -30.f) upPressed = true;
-        if (axisY > 30.f) downPressed = true;
-    }
+    bool upPressed = m_input.up;
+    bool downPressed = m_input.down;
     
     if (upPressed) {
         attackType = Attack::Type::Up;
@@ -809,14 +753,12 @@ void Player::performLightAttack() {
         damageMultiplier *= SPIRIT_STRIKE_DAMAGE_MULTIPLIER;
     }
     
-    m_activeAttacks.push_back(
-        std::make_unique<Attack>(attackType, m_position, m_facingRight, damageMultiplier)
-    );
+    m_attacks.spawn(attackType, m_transform->position, m_facingRight, damageMultiplier);
     m_attackCooldown = LIGHT_ATTACK_COOLDOWN;
     m_isAttacking = true;
     
     // Enhanced attack particles (scaled by combo)
-    sf::Vector2f attackPos = m_position + sf::Vector2f(m_facingRight ? m_size.x : 0.f, m_size.y / 2.f);
+    sf::Vector2f attackPos = m_transform->position + sf::Vector2f(m_facingRight ? m_transform->size.x : 0.f, m_transform->size.y / 2.f);
     
     // Base burst
     m_particles.emitBurst(attackPos, particleCount / 2, particleColor, 80.f, 150.f + (m_comboCount * 30.f), 0.3f, 3.f);
@@ -869,15 +811,8 @@ void Player::releaseHeavyAttack() {
     float damageMultiplier = 1.5f + (chargeLevel * 1.0f);  // 1.5x to 2.5x damage
     
     // Check for launcher (Up + Heavy)
-    bool upPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W) || 
-                     sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up);
-    bool downPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S) || 
-                       sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Down);
-    if (sf::Joystick::isConnected(0)) {
-        float axisY = sf::Joystick::getAxisPosition(0, sf::Joystick::Axis::Y);
-        if (axisY < -30.f) upPressed = true;
-        if (axisY > 30.f) downPressed = true;
-    }
+    bool upPressed = m_input.up;
+    bool downPressed = m_input.down;
     
     if (upPressed) {
         // LAUNCHER ATTACK - pops enemies up
@@ -892,14 +827,12 @@ void Player::releaseHeavyAttack() {
         damageMultiplier *= SPIRIT_STRIKE_DAMAGE_MULTIPLIER;
     }
     
-    m_activeAttacks.push_back(
-        std::make_unique<Attack>(attackType, m_position, m_facingRight, damageMultiplier)
-    );
+    m_attacks.spawn(attackType, m_transform->position, m_facingRight, damageMultiplier);
     m_attackCooldown = HEAVY_ATTACK_COOLDOWN;
     m_isAttacking = true;
     
     // Enhanced heavy attack particles (scale with charge)
-    sf::Vector2f attackPos = m_position + sf::Vector2f(m_facingRight ? m_size.x : 0.f, m_size.y / 2.f);
+    sf::Vector2f attackPos = m_transform->position + sf::Vector2f(m_facingRight ? m_transform->size.x : 0.f, m_transform->size.y / 2.f);
     int particleCount = 15 + static_cast<int>(chargeLevel * 20.f);
     sf::Color particleColor = upPressed ? sf::Color(100, 255, 255) : sf::Color(255, 150, 50);
     
@@ -940,7 +873,7 @@ void Player::performParry() {
     m_parryTimer = 0.0f;  // Reset timer when starting parry
     
     // Parry flash particles (slightly bigger for clarity)
-    sf::Vector2f center = m_position + sf::Vector2f(m_size.x / 2.f, m_size.y / 2.f);
+    sf::Vector2f center = m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y / 2.f);
     m_particles.emitBurst(center, 28, sf::Color(120, 210, 255), 140.f, 200.f, 0.45f, 3.5f);
 }
 
@@ -949,7 +882,7 @@ void Player::activateSpiritStrike() {
     m_spiritStrikeCooldown = SPIRIT_STRIKE_COOLDOWN_TIME;
     
     // Enhanced Spirit Strike activation
-    sf::Vector2f center = m_position + sf::Vector2f(m_size.x / 2.f, m_size.y / 2.f);
+    sf::Vector2f center = m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y / 2.f);
     
     // Explosion burst
     m_particles.emitExplosion(center, sf::Color(150, 220, 255), 3, 12);
@@ -970,11 +903,11 @@ void Player::activateEchoStep() {
     m_echoTimer = ECHO_STEP_DURATION;
     m_echoCooldown = ECHO_STEP_COOLDOWN;
     // Brief invulnerability during Echo Step
-    m_invulnerable = true;
-    m_invulnerabilityTimer = ECHO_STEP_DURATION;
+    m_vitals->invulnerable = true;
+    m_vitals->invulnerabilityTimer = ECHO_STEP_DURATION;
     
     // Enhanced dash activation
-    sf::Vector2f dashPos = m_position + sf::Vector2f(m_size.x / 2.f, m_size.y / 2.f);
+    sf::Vector2f dashPos = m_transform->position + sf::Vector2f(m_transform->size.x / 2.f, m_transform->size.y / 2.f);
     
     // Burst with sparks
     m_particles.emitBurst(dashPos, 15, sf::Color(200, 240, 255), 150.f, 250.f, 0.5f, 3.f);
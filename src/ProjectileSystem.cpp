@@ -0,0 +1,188 @@
+#include "ProjectileSystem.hpp"
+#include "SpriteBatch.hpp"
+#include "ViewCuller.hpp"
+#include <cmath>
+
+namespace {
+    constexpr float PI = 3.14159265f;
+
+    constexpr std::size_t FILL_VERTEX_COUNT = (ProjectileSystem::CIRCLE_SEGMENTS - 2) * 3;
+
+    const sf::Color OUTLINE_COLOR(255, 255, 255, 150);
+}
+
+ProjectileSystem::ProjectileSystem()
+    : m_shotTemplate()
+{
+    m_positionX.reserve(MAX_PROJECTILES);
+    m_positionY.reserve(MAX_PROJECTILES);
+    m_previousX.reserve(MAX_PROJECTILES);
+    m_previousY.reserve(MAX_PROJECTILES);
+    m_velocityX.reserve(MAX_PROJECTILES);
+    m_velocityY.reserve(MAX_PROJECTILES);
+    m_lifetime.reserve(MAX_PROJECTILES);
+    m_damage.reserve(MAX_PROJECTILES);
+    m_owner.reserve(MAX_PROJECTILES);
+    m_color.reserve(MAX_PROJECTILES);
+    m_vertices.reserve(MAX_PROJECTILES * VERTICES_PER_SHOT);
+
+    // Build one shot around the origin: a filled circle with an outline ring
+    // outside it, starting at the top like sf::CircleShape
+    std::array<sf::Vector2f, CIRCLE_SEGMENTS> unit;
+    for (std::size_t i = 0; i < CIRCLE_SEGMENTS; ++i) {
+        float angle = static_cast<float>(i) * 2.f * PI / static_cast<float>(CIRCLE_SEGMENTS) - PI / 2.f;
+        unit[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+    }
+
+    sf::Vertex* out = m_shotTemplate.data();
+    for (std::size_t i = 2; i < CIRCLE_SEGMENTS; ++i) {
+        *out++ = sf::Vertex{unit[0] * RADIUS};
+        *out++ = sf::Vertex{unit[i - 1] * RADIUS};
+        *out++ = sf::Vertex{unit[i] * RADIUS};
+    }
+    const float outer = RADIUS + OUTLINE_THICKNESS;
+    for (std::size_t i = 0; i < CIRCLE_SEGMENTS; ++i) {
+        const sf::Vector2f& a = unit[i];
+        const sf::Vector2f& b = unit[(i + 1) % CIRCLE_SEGMENTS];
+        *out++ = sf::Vertex{a * RADIUS, OUTLINE_COLOR};
+        *out++ = sf::Vertex{a * outer, OUTLINE_COLOR};
+        *out++ = sf::Vertex{b * outer, OUTLINE_COLOR};
+        *out++ = sf::Vertex{a * RADIUS, OUTLINE_COLOR};
+        *out++ = sf::Vertex{b * outer, OUTLINE_COLOR};
+        *out++ = sf::Vertex{b * RADIUS, OUTLINE_COLOR};
+    }
+
+    // Trail particles drift slowly behind the shot, their own trails would be invisible
+    m_trail.setTrailsEnabled(false);
+}
+
+bool ProjectileSystem::spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, int damage,
+                             const sf::Color& color, const Entity* owner) {
+    if (size() >= MAX_PROJECTILES) {
+        return false;
+    }
+
+    m_positionX.push_back(position.x);
+    m_positionY.push_back(position.y);
+    m_previousX.push_back(position.x);
+    m_previousY.push_back(position.y);
+    m_velocityX.push_back(velocity.x);
+    m_velocityY.push_back(velocity.y);
+    m_lifetime.push_back(LIFETIME);
+    m_damage.push_back(damage);
+    m_owner.push_back(owner);
+    m_color.push_back(color);
+    return true;
+}
+
+void ProjectileSystem::update(float deltaTime) {
+    // Shots that hit something last tick
+    removeInactive();
+
+    const std::size_t count = size();
+    for (std::size_t i = 0; i < count; ++i) {
+        m_previousX[i] = m_positionX[i];
+        m_previousY[i] = m_positionY[i];
+        m_positionX[i] += m_velocityX[i] * deltaTime;
+        m_positionY[i] += m_velocityY[i] * deltaTime;
+        m_lifetime[i] -= deltaTime;
+    }
+
+    // Trails are emitted from every shot, including the ones that just expired
+    for (std::size_t i = 0; i < count; ++i) {
+        sf::Color trailColor(m_color[i].r, m_color[i].g, m_color[i].b, 180);
+        m_trail.emitTrail(sf::Vector2f(m_positionX[i], m_positionY[i]), trailColor, 2, 3.f);
+    }
+
+    removeInactive();
+}
+
+void ProjectileSystem::render(SpriteBatch& batch, ViewCuller& culler) {
+    m_vertices.clear();
+
+    const std::size_t count = size();
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!isActive(i) || !culler.isVisible(getBounds(i))) continue;
+
+        const sf::Vector2f center(m_positionX[i], m_positionY[i]);
+        const std::size_t first = m_vertices.size();
+        m_vertices.insert(m_vertices.end(), m_shotTemplate.begin(), m_shotTemplate.end());
+        for (std::size_t v = first; v < m_vertices.size(); ++v) {
+            m_vertices[v].position += center;
+        }
+        for (std::size_t v = first; v < first + FILL_VERTEX_COUNT; ++v) {
+            m_vertices[v].color = m_color[i];
+        }
+    }
+
+    if (!m_vertices.empty()) {
+        batch.submit(m_vertices.data(), m_vertices.size(), nullptr, RenderLayer::Projectiles);
+    }
+}
+
+void ProjectileSystem::releaseOwnedBy(const Entity* owner) {
+    const std::size_t count = size();
+    for (std::size_t i = 0; i < count; ++i) {
+        if (m_owner[i] == owner) {
+            m_lifetime[i] = 0.f;
+            m_owner[i] = nullptr;
+        }
+    }
+}
+
+void ProjectileSystem::clear() {
+    m_positionX.clear();
+    m_positionY.clear();
+    m_previousX.clear();
+    m_previousY.clear();
+    m_velocityX.clear();
+    m_velocityY.clear();
+    m_lifetime.clear();
+    m_damage.clear();
+    m_owner.clear();
+    m_color.clear();
+}
+
+sf::FloatRect ProjectileSystem::getBounds(std::size_t i) const {
+    return sf::FloatRect(sf::Vector2f(m_positionX[i] - RADIUS, m_positionY[i] - RADIUS),
+                         sf::Vector2f(RADIUS * 2.f, RADIUS * 2.f));
+}
+
+sf::FloatRect ProjectileSystem::getPreviousBounds(std::size_t i) const {
+    return sf::FloatRect(sf::Vector2f(m_previousX[i] - RADIUS, m_previousY[i] - RADIUS),
+                         sf::Vector2f(RADIUS * 2.f, RADIUS * 2.f));
+}
+
+void ProjectileSystem::removeInactive() {
+    const std::size_t count = size();
+    std::size_t write = 0;
+    for (std::size_t read = 0; read < count; ++read) {
+        if (m_lifetime[read] <= 0.f) continue;
+
+        if (write != read) {
+            m_positionX[write] = m_positionX[read];
+            m_positionY[write] = m_positionY[read];
+            m_previousX[write] = m_previousX[read];
+            m_previousY[write] = m_previousY[read];
+            m_velocityX[write] = m_velocityX[read];
+            m_velocityY[write] = m_velocityY[read];
+            m_lifetime[write] = m_lifetime[read];
+            m_damage[write] = m_damage[read];
+            m_owner[write] = m_owner[read];
+            m_color[write] = m_color[read];
+        }
+        ++write;
+    }
+    if (write == count) return;
+
+    m_positionX.resize(write);
+    m_positionY.resize(write);
+    m_previousX.resize(write);
+    m_previousY.resize(write);
+    m_velocityX.resize(write);
+    m_velocityY.resize(write);
+    m_lifetime.resize(write);
+    m_damage.resize(write);
+    m_owner.resize(write);
+    m_color.resize(write);
+}
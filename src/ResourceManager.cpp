@@ -1,11 +1,80 @@
 #include "ResourceManager.hpp"
+#include "PixelArtGenerator.hpp"
+#include "ThreadPool.hpp"
 #include <iostream>
+#include <utility>
+
+// Set by the build to a directory next to the executable; other builds use the working directory
+#ifndef KAIZEN_CACHE_DIR
+    #define KAIZEN_CACHE_DIR "cache"
+#endif
+
+namespace {
+
+const char* getSpriteSheetName(SpriteSheetKind kind) {
+    switch (kind) {
+        case SpriteSheetKind::Player: return "player";
+        case SpriteSheetKind::Enemy: return "enemy";
+        case SpriteSheetKind::Boss: return "boss";
+        case SpriteSheetKind::Count: break;
+    }
+    return "unknown";
+}
+
+sf::Vector2i getSpriteSheetFrameSize(SpriteSheetKind kind) {
+    switch (kind) {
+        case SpriteSheetKind::Player:
+            return sf::Vector2i(PixelArtGenerator::PLAYER_FRAME_WIDTH, PixelArtGenerator::PLAYER_FRAME_HEIGHT);
+        case SpriteSheetKind::Enemy:
+            return sf::Vector2i(PixelArtGenerator::ENEMY_FRAME_WIDTH, PixelArtGenerator::ENEMY_FRAME_HEIGHT);
+        case SpriteSheetKind::Boss:
+            return sf::Vector2i(PixelArtGenerator::BOSS_FRAME_WIDTH, PixelArtGenerator::BOSS_FRAME_HEIGHT);
+        case SpriteSheetKind::Count: break;
+    }
+    return sf::Vector2i(0, 0);
+}
+
+sf::Image drawSpriteSheet(SpriteSheetKind kind) {
+    switch (kind) {
+        case SpriteSheetKind::Player: return PixelArtGenerator::drawPlayerSpriteSheet();
+        case SpriteSheetKind::Enemy: return PixelArtGenerator::drawEnemySpriteSheet();
+        case SpriteSheetKind::Boss: return PixelArtGenerator::drawBossSpriteSheet();
+        case SpriteSheetKind::Count: break;
+    }
+    return sf::Image();
+}
+
+// Runs on worker threads during prefetch; each kind has its own cache file
+sf::Image loadOrDrawSpriteSheet(const SpriteSheetCache& cache, SpriteSheetKind kind) {
+    // Everything the image depends on: the art revision and which sheet it is
+    const std::uint32_t version = PixelArtGenerator::VERSION;
+    const std::uint8_t kindId = static_cast<std::uint8_t>(kind);
+    std::uint64_t key = SpriteSheetCache::hash(&version, sizeof(version));
+    key = SpriteSheetCache::hash(&kindId, sizeof(kindId), key);
+    
+    const char* name = getSpriteSheetName(kind);
+    if (std::optional<sf::Image> cached = cache.load(name, key)) {
+        std::cout << "Loaded sprite sheet '" << name << "' from disk cache" << std::endl;
+        return std::move(*cached);
+    }
+    
+    sf::Image image = drawSpriteSheet(kind);
+    cache.store(name, key, image);
+    return image;
+}
+
+} // namespace
 
 ResourceManager& ResourceManager::getInstance() {
     static ResourceManager instance;
     return instance;
 }
 
+ResourceManager::ResourceManager()
+    : m_sheetCache(std::filesystem::path(KAIZEN_CACHE_DIR) / "sprites")
+{
+}
+
 bool ResourceManager::loadTexture(const std::string& id, const std::string& filepath) {
     // Check if already loaded
     if (hasTexture(id)) {
@@ -101,7 +170,71 @@ bool ResourceManager::hasSoundBuffer(const std::string& id) const {
     return m_soundBuffers.find(id) != m_soundBuffers.end();
 }
 
+AtlasRegion ResourceManager::acquireSpriteSheet(SpriteSheetKind kind) {
+    // Textures need a GPU context, which headless runs don't have
+    if (m_headless) {
+        AtlasRegion region;
+        region.frameSize = getSpriteSheetFrameSize(kind);
+        return region;
+    }
+    
+    auto cached = m_spriteSheets.find(kind);
+    if (cached != m_spriteSheets.end()) {
+        if (auto page = cached->second.page.lock()) {
+            return AtlasRegion{page, cached->second.bounds, cached->second.frameSize};
+        }
+    }
+    
+    // Pack every sheet that isn't on a live page, so sheets loaded together share one
+    TextureAtlas atlas;
+    std::vector<SpriteSheetKind> packed;
+    for (int i = 0; i < static_cast<int>(SpriteSheetKind::Count); ++i) {
+        SpriteSheetKind each = static_cast<SpriteSheetKind>(i);
+        auto existing = m_spriteSheets.find(each);
+        if (existing != m_spriteSheets.end() && !existing->second.page.expired()) {
+            continue;
+        }
+        
+        // Use the prefetched image if there is one, otherwise draw it now
+        sf::Image image;
+        auto pending = m_pendingSheets.find(each);
+        if (pending != m_pendingSheets.end()) {
+            image = pending->second.get();
+            m_pendingSheets.erase(pending);
+        } else {
+            image = loadOrDrawSpriteSheet(m_sheetCache, each);
+        }
+        atlas.add(getSpriteSheetName(each), image, getSpriteSheetFrameSize(each));
+        packed.push_back(each);
+    }
+    
+    // Upload here: textures belong to the main thread's GL context
+    atlas.build();
+    
+    AtlasRegion result;
+    for (SpriteSheetKind each : packed) {
+        AtlasRegion region = atlas.getRegion(getSpriteSheetName(each));
+        m_spriteSheets[each] = CachedSheet{region.texture, region.bounds, region.frameSize};
+        if (each == kind) {
+            result = region;
+        }
+    }
+    return result;
+}
+
+void ResourceManager::prefetchSpriteSheet(SpriteSheetKind kind) {
+    if (m_headless || m_pendingSheets.count(kind) > 0) {
+        return;
+    }
+    const SpriteSheetCache* cache = &m_sheetCache;
+    m_pendingSheets[kind] = ThreadPool::getInstance().submit([cache, kind]() {
+        return loadOrDrawSpriteSheet(*cache, kind);
+    });
+}
+
 void ResourceManager::clear() {
+    m_pendingSheets.clear();  // Workers finish on their own, their images are dropped
+    m_spriteSheets.clear();  // Atlas pages still in use stay alive with their regions
     m_textures.clear();
     m_fonts.clear();
     m_soundBuffers.clear();
@@ -0,0 +1,214 @@
+#include "SpriteBatch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+constexpr int LAYER_SHIFT = 48;
+constexpr int TEXTURE_SHIFT = 32;
+constexpr std::uint64_t TEXTURE_MASK = 0xFFFF;
+
+// Map a float to an unsigned int with the same ordering (negative depths included)
+std::uint32_t orderedBits(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+// Unit normal of the edge p1 -> p2
+sf::Vector2f edgeNormal(const sf::Vector2f& p1, const sf::Vector2f& p2) {
+    sf::Vector2f normal(p1.y - p2.y, p2.x - p1.x);
+    const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+    return length != 0.f ? normal / length : normal;
+}
+
+float dot(const sf::Vector2f& a, const sf::Vector2f& b) {
+    return a.x * b.x + a.y * b.y;
+}
+
+} // namespace
+
+SpriteBatch::SpriteBatch()
+    : m_vertices(sf::PrimitiveType::Triangles)
+    , m_lastDrawCalls(0)
+{
+    m_textures.push_back(nullptr);
+}
+
+std::uint64_t SpriteBatch::makeKey(RenderLayer layer, const sf::Texture* texture, float depth) {
+    // Texture ids are handed out per frame; a level only ever has a few textures
+    auto it = std::find(m_textures.begin(), m_textures.end(), texture);
+    if (it == m_textures.end()) {
+        it = m_textures.insert(m_textures.end(), texture);
+    }
+    const auto textureId = static_cast<std::uint64_t>(it - m_textures.begin()) & TEXTURE_MASK;
+
+    return (static_cast<std::uint64_t>(layer) << LAYER_SHIFT)
+         | (textureId << TEXTURE_SHIFT)
+         | orderedBits(depth);
+}
+
+sf::Vertex* SpriteBatch::allocate(std::size_t count, const sf::Texture* texture, RenderLayer layer, float depth) {
+    const std::size_t first = m_staging.size();
+    m_commands.push_back({makeKey(layer, texture, depth),
+                          static_cast<std::uint32_t>(first),
+                          static_cast<std::uint32_t>(count)});
+    m_staging.resize(first + count);
+    return m_staging.data() + first;
+}
+
+void SpriteBatch::submit(const sf::Sprite& sprite, RenderLayer layer, float depth) {
+    // Same quad sf::Sprite builds: local size is the absolute texture rect size
+    const sf::IntRect rect = sprite.getTextureRect();
+    const sf::Vector2f size(std::abs(static_cast<float>(rect.size.x)), std::abs(static_cast<float>(rect.size.y)));
+    const float left = static_cast<float>(rect.position.x);
+    const float top = static_cast<float>(rect.position.y);
+    const float right = left + static_cast<float>(rect.size.x);
+    const float bottom = top + static_cast<float>(rect.size.y);
+
+    const sf::Transform& transform = sprite.getTransform();
+    const sf::Color color = sprite.getColor();
+    const sf::Vertex corners[4] = {
+        {transform.transformPoint({0.f, 0.f}), color, {left, top}},
+        {transform.transformPoint({0.f, size.y}), color, {left, bottom}},
+        {transform.transformPoint({size.x, 0.f}), color, {right, top}},
+        {transform.transformPoint(size), color, {right, bottom}}
+    };
+
+    sf::Vertex* out = allocate(6, &sprite.getTexture(), layer, depth);
+    out[0] = corners[0];
+    out[1] = corners[1];
+    out[2] = corners[2];
+    out[3] = corners[2];
+    out[4] = corners[1];
+    out[5] = corners[3];
+}
+
+void SpriteBatch::submit(const sf::Shape& shape, RenderLayer layer, float depth) {
+    const std::size_t pointCount = shape.getPointCount();
+    if (pointCount < 3) return;
+
+    const sf::Transform& transform = shape.getTransform();
+    const float thickness = shape.getOutlineThickness();
+    const bool hasOutline = thickness != 0.f;
+
+    // Fill as a fan, then the outline band as one quad per edge
+    const std::size_t fillCount = (pointCount - 2) * 3;
+    const std::size_t outlineCount = hasOutline ? pointCount * 6 : 0;
+    sf::Vertex* out = allocate(fillCount + outlineCount, nullptr, layer, depth);
+
+    const sf::Color fill = shape.getFillColor();
+    const sf::Vector2f first = transform.transformPoint(shape.getPoint(0));
+    sf::Vector2f previous = transform.transformPoint(shape.getPoint(1));
+    for (std::size_t i = 2; i < pointCount; ++i) {
+        const sf::Vector2f current = transform.transformPoint(shape.getPoint(i));
+        *out++ = sf::Vertex{first, fill};
+        *out++ = sf::Vertex{previous, fill};
+        *out++ = sf::Vertex{current, fill};
+        previous = current;
+    }
+
+    if (!hasOutline) return;
+
+    // Outline offset matches sf::Shape: each point moves along the mitred normal of its two edges
+    sf::Vector2f center;
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        center += shape.getPoint(i);
+    }
+    center /= static_cast<float>(pointCount);
+
+    auto outerPoint = [&](std::size_t index) {
+        const sf::Vector2f p0 = shape.getPoint((index + pointCount - 1) % pointCount);
+        const sf::Vector2f p1 = shape.getPoint(index);
+        const sf::Vector2f p2 = shape.getPoint((index + 1) % pointCount);
+        sf::Vector2f n1 = edgeNormal(p0, p1);
+        sf::Vector2f n2 = edgeNormal(p1, p2);
+        // Point the normals away from the centre whatever the winding
+        if (dot(n1, center - p1) > 0.f) n1 = -n1;
+        if (dot(n2, center - p1) > 0.f) n2 = -n2;
+        const float factor = 1.f + dot(n1, n2);
+        const sf::Vector2f normal = factor != 0.f ? (n1 + n2) / factor : n1;
+        return transform.transformPoint(p1 + normal * thickness);
+    };
+
+    const sf::Color outline = shape.getOutlineColor();
+    sf::Vector2f inner0 = transform.transformPoint(shape.getPoint(0));
+    sf::Vector2f outer0 = outerPoint(0);
+    const sf::Vector2f firstInner = inner0;
+    const sf::Vector2f firstOuter = outer0;
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        const bool last = i + 1 == pointCount;
+        const sf::Vector2f inner1 = last ? firstInner : transform.transformPoint(shape.getPoint(i + 1));
+        const sf::Vector2f outer1 = last ? firstOuter : outerPoint(i + 1);
+        *out++ = sf::Vertex{inner0, outline};
+        *out++ = sf::Vertex{outer0, outline};
+        *out++ = sf::Vertex{outer1, outline};
+        *out++ = sf::Vertex{inner0, outline};
+        *out++ = sf::Vertex{outer1, outline};
+        *out++ = sf::Vertex{inner1, outline};
+        inner0 = inner1;
+        outer0 = outer1;
+    }
+}
+
+void SpriteBatch::submit(const sf::FloatRect& rect, const sf::Color& color, RenderLayer layer, float depth) {
+    const sf::Vector2f a = rect.position;
+    const sf::Vector2f b(rect.position.x + rect.size.x, rect.position.y);
+    const sf::Vector2f c = rect.position + rect.size;
+    const sf::Vector2f d(rect.position.x, rect.position.y + rect.size.y);
+
+    sf::Vertex* out = allocate(6, nullptr, layer, depth);
+    out[0] = sf::Vertex{a, color};
+    out[1] = sf::Vertex{b, color};
+    out[2] = sf::Vertex{c, color};
+    out[3] = sf::Vertex{a, color};
+    out[4] = sf::Vertex{c, color};
+    out[5] = sf::Vertex{d, color};
+}
+
+void SpriteBatch::submit(const sf::Vertex* vertices, std::size_t count, const sf::Texture* texture,
+                         RenderLayer layer, float depth) {
+    if (count == 0) return;
+    std::copy_n(vertices, count, allocate(count, texture, layer, depth));
+}
+
+void SpriteBatch::flush(sf::RenderTarget& target) {
+    m_lastDrawCalls = 0;
+    if (m_commands.empty()) return;
+
+    // Stable, so equal keys keep the order they were submitted in
+    std::stable_sort(m_commands.begin(), m_commands.end(), [](const Command& a, const Command& b) {
+        return a.key < b.key;
+    });
+
+    m_vertices.resize(m_staging.size());
+    std::size_t written = 0;
+    std::size_t runStart = 0;
+    std::uint64_t runTexture = m_commands.front().key >> TEXTURE_SHIFT & TEXTURE_MASK;
+
+    auto drawRun = [&]() {
+        if (written == runStart) return;
+        sf::RenderStates states;
+        states.texture = m_textures[runTexture];
+        target.draw(&m_vertices[runStart], written - runStart, sf::PrimitiveType::Triangles, states);
+        ++m_lastDrawCalls;
+    };
+
+    // Neighbouring commands that share a texture merge into one draw, even across layers
+    for (const Command& command : m_commands) {
+        const std::uint64_t texture = command.key >> TEXTURE_SHIFT & TEXTURE_MASK;
+        if (texture != runTexture) {
+            drawRun();
+            runStart = written;
+            runTexture = texture;
+        }
+        std::copy_n(m_staging.data() + command.firstVertex, command.vertexCount, &m_vertices[written]);
+        written += command.vertexCount;
+    }
+    drawRun();
+
+    m_staging.clear();
+    m_commands.clear();
+    m_textures.resize(1);
+}
@@ -0,0 +1,136 @@
+#include "SpriteSheetCache.hpp"
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Header fields are little-endian on disk regardless of the host
+void putU32(std::uint8_t* out, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+}
+
+void putU64(std::uint8_t* out, std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+}
+
+std::uint32_t getU32(const std::uint8_t* in) {
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value |= static_cast<std::uint32_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+std::uint64_t getU64(const std::uint8_t* in) {
+    std::uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+} // namespace
+
+SpriteSheetCache::SpriteSheetCache(std::filesystem::path directory)
+    : m_directory(std::move(directory))
+{
+}
+
+std::uint64_t SpriteSheetCache::hash(const void* data, std::size_t size, std::uint64_t seed) {
+    constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    std::uint64_t result = seed;
+    for (std::size_t i = 0; i < size; ++i) {
+        result ^= bytes[i];
+        result *= FNV_PRIME;
+    }
+    return result;
+}
+
+std::filesystem::path SpriteSheetCache::getPath(const std::string& name) const {
+    return m_directory / (name + ".sheet");
+}
+
+std::optional<sf::Image> SpriteSheetCache::load(const std::string& name, std::uint64_t key) const {
+    std::ifstream file(getPath(name), std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+
+    // Layout: magic, format version, key, width, height, pixel checksum
+    std::array<std::uint8_t, HEADER_SIZE> header{};
+    if (!file.read(reinterpret_cast<char*>(header.data()), header.size())) {
+        return std::nullopt;
+    }
+    if (getU32(&header[0]) != MAGIC || getU32(&header[4]) != FORMAT_VERSION || getU64(&header[8]) != key) {
+        return std::nullopt;
+    }
+
+    const std::uint32_t width = getU32(&header[16]);
+    const std::uint32_t height = getU32(&header[20]);
+    if (width == 0 || height == 0 || width > MAX_DIMENSION || height > MAX_DIMENSION) {
+        return std::nullopt;
+    }
+
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width) * height * 4);
+    if (!file.read(reinterpret_cast<char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()))) {
+        return std::nullopt;
+    }
+    if (hash(pixels.data(), pixels.size()) != getU64(&header[24])) {
+        std::cerr << "Sprite sheet cache '" << name << "' is damaged, regenerating." << std::endl;
+        return std::nullopt;
+    }
+
+    return sf::Image({width, height}, pixels.data());
+}
+
+bool SpriteSheetCache::store(const std::string& name, std::uint64_t key, const sf::Image& image) const {
+    const sf::Vector2u size = image.getSize();
+    const std::uint8_t* pixels = image.getPixelsPtr();
+    if (pixels == nullptr) {
+        return false;
+    }
+    const std::size_t byteCount = static_cast<std::size_t>(size.x) * size.y * 4;
+
+    std::array<std::uint8_t, HEADER_SIZE> header{};
+    putU32(&header[0], MAGIC);
+    putU32(&header[4], FORMAT_VERSION);
+    putU64(&header[8], key);
+    putU32(&header[16], size.x);
+    putU32(&header[20], size.y);
+    putU64(&header[24], hash(pixels, byteCount));
+
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+
+    // Write beside the real file and swap it in, so readers never see half a sheet
+    const std::filesystem::path path = getPath(name);
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(header.data()), header.size());
+        file.write(reinterpret_cast<const char*>(pixels), static_cast<std::streamsize>(byteCount));
+        if (!file) {
+            std::cerr << "Failed to write sprite sheet cache: " << temporary.string() << std::endl;
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        std::cerr << "Failed to write sprite sheet cache: " << path.string() << std::endl;
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,118 @@
+#include "TextureAtlas.hpp"
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+namespace {
+
+// Next-fit shelf packing state for one page
+struct PageLayout {
+    sf::Vector2i limit;  // Page size the packer may fill
+    sf::Vector2i used;  // Extent actually covered (the uploaded page size)
+    int shelfY = 0;
+    int shelfHeight = 0;
+    int cursorX = 0;
+};
+
+struct Placement {
+    std::size_t page = 0;
+    sf::Vector2i position;
+};
+
+} // namespace
+
+TextureAtlas::TextureAtlas(unsigned int pageSize)
+    : m_pageSize(pageSize)
+{
+}
+
+void TextureAtlas::add(const std::string& name, const sf::Image& image, const sf::Vector2i& frameSize) {
+    m_pending.push_back({name, image, frameSize});
+}
+
+bool TextureAtlas::build() {
+    if (m_pending.empty()) return true;
+
+    // Tallest images first keeps shelves tight
+    std::vector<std::size_t> order(m_pending.size());
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+        return m_pending[a].image.getSize().y > m_pending[b].image.getSize().y;
+    });
+
+    const int pageSize = static_cast<int>(m_pageSize);
+    std::vector<PageLayout> layouts;
+    std::vector<Placement> placements(m_pending.size());
+    for (std::size_t index : order) {
+        const sf::Vector2i size(m_pending[index].image.getSize());
+
+        bool placed = false;
+        if (!layouts.empty()) {
+            PageLayout& page = layouts.back();
+            // Row full: start a new shelf above the tallest image of this one
+            if (page.cursorX + size.x > page.limit.x) {
+                page.shelfY += page.shelfHeight + PADDING;
+                page.shelfHeight = 0;
+                page.cursorX = 0;
+            }
+            placed = page.cursorX + size.x <= page.limit.x && page.shelfY + size.y <= page.limit.y;
+        }
+        if (!placed) {
+            // Oversized images get a page of their own size
+            PageLayout page;
+            page.limit = sf::Vector2i(std::max(pageSize, size.x), std::max(pageSize, size.y));
+            layouts.push_back(page);
+        }
+
+        PageLayout& page = layouts.back();
+        placements[index] = {m_pages.size() + layouts.size() - 1, sf::Vector2i(page.cursorX, page.shelfY)};
+        page.cursorX += size.x + PADDING;
+        page.shelfHeight = std::max(page.shelfHeight, size.y);
+        page.used.x = std::max(page.used.x, placements[index].position.x + size.x);
+        page.used.y = std::max(page.used.y, placements[index].position.y + size.y);
+    }
+
+    // Compose each page on the CPU, then upload it once
+    const std::size_t firstPage = m_pages.size();
+    bool success = true;
+    for (std::size_t p = 0; p < layouts.size(); ++p) {
+        sf::Image pageImage(sf::Vector2u(layouts[p].used), sf::Color::Transparent);
+        for (std::size_t i = 0; i < m_pending.size(); ++i) {
+            if (placements[i].page != firstPage + p) continue;
+            if (!pageImage.copy(m_pending[i].image, sf::Vector2u(placements[i].position))) {
+                std::cerr << "Failed to pack '" << m_pending[i].name << "' into texture atlas" << std::endl;
+                success = false;
+            }
+        }
+
+        auto texture = std::make_shared<sf::Texture>();
+        if (!texture->loadFromImage(pageImage)) {
+            std::cerr << "Failed to upload texture atlas page " << firstPage + p << std::endl;
+            success = false;
+        }
+        texture->setSmooth(false);  // Pixel art style
+        m_pages.push_back(std::move(texture));
+    }
+
+    for (std::size_t i = 0; i < m_pending.size(); ++i) {
+        const PendingImage& pending = m_pending[i];
+        AtlasRegion& region = m_regions[pending.name];
+        region.texture = m_pages[placements[i].page];
+        region.bounds = sf::IntRect(placements[i].position, sf::Vector2i(pending.image.getSize()));
+        region.frameSize = pending.frameSize;
+    }
+    m_pending.clear();
+    return success;
+}
+
+AtlasRegion TextureAtlas::getRegion(const std::string& name) const {
+    auto it = m_regions.find(name);
+    if (it == m_regions.end()) {
+        return AtlasRegion();
+    }
+    return it->second;
+}
+
+bool TextureAtlas::hasRegion(const std::string& name) const {
+    return m_regions.find(name) != m_regions.end();
+}
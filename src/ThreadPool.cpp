@@ -0,0 +1,170 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace {
+
+// Worker the current thread is, if it belongs to a pool
+thread_local const void* t_pool = nullptr;
+thread_local std::size_t t_worker = 0;
+
+// Shared by the caller and helper tasks of one parallelFor; helpers that start late may outlive the call
+struct ParallelForState {
+    const std::function<void(std::size_t, std::size_t)>* body = nullptr;  // Only used while chunks remain
+    std::size_t count = 0;
+    std::size_t chunkSize = 1;
+    std::size_t chunkCount = 0;
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> done{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::exception_ptr error;
+};
+
+void runChunks(ParallelForState& state) {
+    for (std::size_t chunk = state.next.fetch_add(1); chunk < state.chunkCount; chunk = state.next.fetch_add(1)) {
+        const std::size_t begin = chunk * state.chunkSize;
+        const std::size_t end = std::min(begin + state.chunkSize, state.count);
+        try {
+            (*state.body)(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (!state.error) {
+                state.error = std::current_exception();
+            }
+        }
+
+        if (state.done.fetch_add(1) + 1 == state.chunkCount) {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.finished.notify_all();
+        }
+    }
+}
+
+} // namespace
+
+ThreadPool& ThreadPool::getInstance() {
+    static ThreadPool instance(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return instance;
+}
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+    : m_queuedTasks(0)
+    , m_nextQueue(0)
+    , m_stopping(false)
+{
+    // At least one worker, or submitted tasks would never run
+    threadCount = std::max(1u, threadCount);
+    m_queues.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    m_workers.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        m_workers.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_taskAvailable.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    // Tasks spawned by a task stay with its worker, everything else is dealt out
+    const std::size_t target = (t_pool == this) ? t_worker : m_nextQueue.fetch_add(1) % m_queues.size();
+    {
+        std::lock_guard<std::mutex> lock(m_queues[target]->mutex);
+        m_queues[target]->tasks.push_back(std::move(task));
+    }
+    m_queuedTasks.fetch_add(1);
+
+    // Taking the lock orders this with a worker checking the count before it sleeps
+    { std::lock_guard<std::mutex> lock(m_mutex); }
+    m_taskAvailable.notify_one();
+}
+
+bool ThreadPool::takeTask(std::size_t worker, std::function<void()>& task) {
+    // Newest of our own tasks first (its data is most likely still in cache)
+    {
+        WorkerQueue& own = *m_queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            m_queuedTasks.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Then steal the oldest task of another worker
+    for (std::size_t offset = 1; offset < m_queues.size(); ++offset) {
+        WorkerQueue& victim = *m_queues[(worker + offset) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            m_queuedTasks.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(std::size_t worker) {
+    t_pool = this;
+    t_worker = worker;
+
+    for (;;) {
+        std::function<void()> task;
+        if (takeTask(worker, task)) {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_taskAvailable.wait(lock, [this]() { return m_stopping || m_queuedTasks.load() > 0; });
+        // Drain the queues before exiting so no future is left without a value
+        if (m_stopping && m_queuedTasks.load() == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& body) {
+    parallelFor(count, 1, [&body](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; ++index) {
+            body(index);
+        }
+    });
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t chunkSize,
+                             const std::function<void(std::size_t, std::size_t)>& body) {
+    if (count == 0) return;
+
+    auto state = std::make_shared<ParallelForState>();
+    state->body = &body;
+    state->count = count;
+    state->chunkSize = std::max<std::size_t>(1, chunkSize);
+    state->chunkCount = (count + state->chunkSize - 1) / state->chunkSize;
+
+    // The caller takes chunks as well, so one chunk needs no helper
+    std::size_t helpers = std::min<std::size_t>(state->chunkCount - 1, m_workers.size());
+    for (std::size_t i = 0; i < helpers; ++i) {
+        enqueue([state]() { runChunks(*state); });
+    }
+    runChunks(*state);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&]() { return state->done.load() == state->chunkCount; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
@@ -0,0 +1,28 @@
+#include "ViewCuller.hpp"
+
+ViewCuller::ViewCuller(float margin)
+    : m_cullRect()
+    , m_margin(margin)
+    , m_stats()
+{
+}
+
+void ViewCuller::begin(const sf::FloatRect& visibleRect) {
+    m_cullRect = sf::FloatRect(visibleRect.position - sf::Vector2f(m_margin, m_margin),
+                               visibleRect.size + sf::Vector2f(m_margin, m_margin) * 2.f);
+    m_stats = CullStats();
+}
+
+bool ViewCuller::isVisible(const sf::FloatRect& bounds) {
+    // Touching edges count as visible so nothing pops at the border
+    const bool visible = bounds.position.x <= m_cullRect.position.x + m_cullRect.size.x
+                      && bounds.position.x + bounds.size.x >= m_cullRect.position.x
+                      && bounds.position.y <= m_cullRect.position.y + m_cullRect.size.y
+                      && bounds.position.y + bounds.size.y >= m_cullRect.position.y;
+    ++(visible ? m_stats.drawn : m_stats.culled);
+    return visible;
+}
+
+bool ViewCuller::isVisible(const sf::Vector2f& point, float radius) {
+    return isVisible(sf::FloatRect(point - sf::Vector2f(radius, radius), sf::Vector2f(radius, radius) * 2.f));
+}
@@ -1,4 +1,5 @@
 #include "Game.hpp"
+#include "ResourceManager.hpp"
 #include <iostream>
 #include <exception>
 
@@ -9,6 +10,12 @@
  */
 int main() {
     try {
+        // Draw the sprite sheets on worker threads while the window opens
+        ResourceManager& resources = ResourceManager::getInstance();
+        resources.prefetchSpriteSheet(SpriteSheetKind::Player);
+        resources.prefetchSpriteSheet(SpriteSheetKind::Enemy);
+        resources.prefetchSpriteSheet(SpriteSheetKind::Boss);
+        
         Game game;
         game.run();
     }